@@ -47,9 +47,8 @@ namespace dxe {
 				float v = 1 - float(k) / float(tessellation);
 
 				float innerAngle = float(k) * tnl::PI * 2.0f / float(tessellation) + tnl::PI;
-				float dx, dy;
-				
-				DirectX::XMScalarSinCos(&dy, &dx, innerAngle);
+				float dx = cosf(innerAngle);
+				float dy = sinf(innerAngle);
 
 				// Create a vertex.
 				tnl::Vector3 normal(dx, dy, 0);
@@ -1,6 +1,11 @@
 #pragma once
 #include "../library/tnl_util.h"
+#include "../library/tnl_affine.h"
+#include "../library/tnl_bvh.h"
+#include "../library/tnl_co_sequence.h"
+#include "../library/tnl_broadphase.h"
 #include "../library/tnl_csv.h"
+#include "../library/tnl_csv_schema.h"
 #include "../library/tnl_font_texture.h"
 #include "../library/tnl_hierarchy_tree.h"
 #include "../library/tnl_input.h"
@@ -9,10 +14,15 @@
 #include "../library/tnl_math.h"
 #include "../library/tnl_matrix.h"
 #include "../library/tnl_quaternion.h"
+#include "../library/tnl_rng.h"
 #include "../library/tnl_sequence.h"
 #include "../library/tnl_shared_factory.h"
+#include "../library/tnl_slab_allocator.h"
+#include "../library/tnl_timeline.h"
 #include "../library/tnl_timer_callback.h"
 #include "../library/tnl_timer_fluct.h"
+#include "../library/tnl_timer_fluct_batch.h"
+#include "../library/tnl_timer_wheel.h"
 #include "../library/tnl_vector.h"
 #include "../library/tnl_seek_unit.h"
 #include "../library/stb_image.h"
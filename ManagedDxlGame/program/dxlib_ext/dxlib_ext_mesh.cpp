@@ -16,6 +16,8 @@ namespace dxe {
 
 		if (!mesh_name_.empty()) other->setName(mesh_name_);
 
+		other->bvh_ = bvh_;
+
 		if (!idxs_.empty()) {
 			other->idxs_.resize(idxs_.size());
 			memcpy(other->idxs_.data(), idxs_.data(), sizeof(uint32_t) * idxs_.size());
@@ -570,33 +572,103 @@ namespace dxe {
 
 
 	//----------------------------------------------------------------------------------------
-	std::vector<tnl::Vector3> Mesh::createWorldVertexs() {
-
-		std::vector<tnl::Vector3> verts;
-		tnl::Matrix tm = tnl::Matrix::Translation(pos_);
-		tnl::Matrix rm = rot_.getMatrix();
-		tnl::Matrix sm = tnl::Matrix::Scaling(scl_);
-		tnl::Matrix wm = sm * rm * tm;
-
-		verts.resize(idxs_.size() * 3);
-		for (int i = 0; i < idxs_.size(); i += 3) {
-			VERTEX3D v1 = vtxs_[idxs_[i + 0]];
-			VERTEX3D v2 = vtxs_[idxs_[i + 1]];
-			VERTEX3D v3 = vtxs_[idxs_[i + 2]];
-			tnl::Vector3 p1 = { v1.pos.x, v1.pos.y, v1.pos.z };
-			tnl::Vector3 p2 = { v2.pos.x, v2.pos.y, v2.pos.z };
-			tnl::Vector3 p3 = { v3.pos.x, v3.pos.y, v3.pos.z };
-			tnl::Matrix wm1 = tnl::Matrix::Translation(p1) * wm;
-			tnl::Matrix wm2 = tnl::Matrix::Translation(p2) * wm;
-			tnl::Matrix wm3 = tnl::Matrix::Translation(p3) * wm;
-			p1 = { wm1._41, wm1._42, wm1._43 };
-			p2 = { wm2._41, wm2._42, wm2._43 };
-			p3 = { wm3._41, wm3._42, wm3._43 };
-			verts[i + 0] = p1;
-			verts[i + 1] = p2;
-			verts[i + 2] = p3;
-		}
-		return verts;
+	const tnl::Affine& Mesh::getWorldAffine() {
+		// p̃Rs[͎A蒼ϊOƈقȂꍇ_LbV𖳌ɂ
+		const tnl::Affine world = tnl::Affine::Create(pos_, rot_, scl_);
+		if (0 != memcmp(&world, &world_, sizeof(tnl::Affine))) {
+			world_ = world;
+			is_world_vtxs_dirty_ = true;
+		}
+		return world_;
+	}
+
+	//----------------------------------------------------------------------------------------
+	const std::vector<tnl::Vector3>& Mesh::createWorldVertexs() {
+
+		uint32_t num = static_cast<uint32_t>(idxs_.size());
+
+		// [JWOp` SoA ɓWJ ( ̂ )
+		if (local_vtxs_soa_.size() != num * 3) {
+			local_vtxs_soa_.resize(num * 3);
+			float* xs = local_vtxs_soa_.data();
+			float* ys = xs + num;
+			float* zs = ys + num;
+			for (uint32_t i = 0; i < num; ++i) {
+				const VERTEX3D& v = vtxs_[idxs_[i]];
+				xs[i] = v.pos.x;
+				ys[i] = v.pos.y;
+				zs[i] = v.pos.z;
+			}
+			is_world_vtxs_dirty_ = true;
+		}
+
+		// pωĂȂ΃LbVԂ
+		const tnl::Affine& world = getWorldAffine();
+		if (!is_world_vtxs_dirty_) return world_vtxs_;
+		is_world_vtxs_dirty_ = false;
+
+		tnl::Matrix wm = world.getMatrix();
+
+		world_vtxs_soa_.resize(num * 3);
+		const float* in = local_vtxs_soa_.data();
+		float* out = world_vtxs_soa_.data();
+		tnl::Vector3::TransformCoord(in, in + num, in + num * 2, out, out + num, out + num * 2, num, wm);
+
+		world_vtxs_.resize(num);
+		for (uint32_t i = 0; i < num; ++i) {
+			world_vtxs_[i] = { out[i], out[num + i], out[num * 2 + i] };
+		}
+		return world_vtxs_;
+	}
+
+
+	//----------------------------------------------------------------------------------------
+	Shared<tnl::TriangleBVH> Mesh::createBVH(const std::string& cache_file_path) {
+		if (vtxs_.empty() || idxs_.empty()) return nullptr;
+
+		const float* positions = &vtxs_[0].pos.x;
+		const uint32_t vtx_num = static_cast<uint32_t>(vtxs_.size());
+		const uint32_t idx_num = static_cast<uint32_t>(idxs_.size());
+		if (!cache_file_path.empty()) {
+			// _CfbNXςbṼLbV͎g킸ɍ蒼
+			bvh_ = tnl::TriangleBVH::CreateFromFile(cache_file_path);
+			if (bvh_
+				&& bvh_->getTriangleNum() == idx_num / 3
+				&& bvh_->getSourceVertexNum() == vtx_num
+				&& bvh_->getSourceHash() == tnl::TriangleBVH::SourceHash(positions, sizeof(VERTEX3D), vtx_num, idxs_.data(), idx_num)) {
+				return bvh_;
+			}
+		}
+
+		bvh_ = tnl::TriangleBVH::Create(positions, sizeof(VERTEX3D), vtx_num, idxs_.data(), idx_num);
+		if (!cache_file_path.empty()) bvh_->exportForFile(cache_file_path);
+		return bvh_;
+	}
+
+	//----------------------------------------------------------------------------------------
+	// C[JԂֈڂ BVH Ŕ肵A_[hԂ֖߂
+	// ( AtBϊȂ̂ŃC̈ʒu֌W͕ςȂ )
+	bool Mesh::isIntersectRay(const tnl::Vector3& pos, const tnl::Vector3& dir, tnl::Vector3* intersect_pos, uint32_t* triangle_index) {
+		if (!bvh_ && !createBVH()) return false;
+
+		const tnl::Affine& world = getWorldAffine();
+		tnl::Affine inv = tnl::Affine::Inverse(world);
+		tnl::Vector3 local_hit;
+		if (!bvh_->isIntersectRay(inv.transformCoord(pos), inv.transformNormal(dir), &local_hit, triangle_index)) return false;
+		if (intersect_pos) *intersect_pos = world.transformCoord(local_hit);
+		return true;
+	}
+
+	//----------------------------------------------------------------------------------------
+	bool Mesh::isIntersectLine(const tnl::Vector3& s, const tnl::Vector3& e, tnl::Vector3* intersect_pos, uint32_t* triangle_index) {
+		if (!bvh_ && !createBVH()) return false;
+
+		const tnl::Affine& world = getWorldAffine();
+		tnl::Affine inv = tnl::Affine::Inverse(world);
+		tnl::Vector3 local_hit;
+		if (!bvh_->isIntersectLine(inv.transformCoord(s), inv.transformCoord(e), &local_hit, triangle_index)) return false;
+		if (intersect_pos) *intersect_pos = world.transformCoord(local_hit);
+		return true;
 	}
 
 
@@ -626,28 +698,10 @@ namespace dxe {
 
 		SetLightEnable(render_param_.is_default_light_enable_);
 
-		// _̎ˉeϊps
-		tnl::Matrix mt_vertex;
-
-		// _̃[hs
-		tnl::Matrix mt_vtx_world;
-
-		// IuWFNgƂĂ̍WE]EXP[E[hs
-		tnl::Matrix mt_trans;
-		tnl::Matrix mt_rotation;
-		tnl::Matrix mt_scale;
-		tnl::Matrix mt_obj_world;
-
 		// IuWFNg̃[hs̍쐬
-		mt_trans = tnl::Matrix::Translation(pos_.x, pos_.y, pos_.z);
-
-		mt_rotation = rot_.getMatrix();
-
-		mt_scale = tnl::Matrix::Scaling(scl_.x, scl_.y, scl_.z);
-
-		// [hsvZ ( XP[s x ]s x Ws )
+		// ( XP[s x ]s x Ws ) sςȂŒڋ߁Apς܂ŕێ
 		//  EWn͍s̊|tɂȂ̂Œ
-		mt_obj_world = mt_scale * mt_rotation * mt_trans;
+		tnl::Matrix mt_obj_world = getWorldAffine().getMatrix();
 
 		MATRIX dxm;
 		memcpy(dxm.m, mt_obj_world.m, sizeof(float)*16);
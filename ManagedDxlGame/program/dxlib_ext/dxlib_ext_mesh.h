@@ -230,9 +230,45 @@ namespace dxe {
 		// `̎擾
 		inline eShapeType getShapeType() { return shape_type_; }
 
+		// [hϊ ( XP[ x ] x W ) ̎擾
+		// tips... Ăяo̓x pos_ rot_ scl_  3x4  tnl::Affine 𒼐ڍ쐬܂ ( s 2 荂 )
+		//         Mesh ͌ʂ tnl::Affine ( 48 byte ) ێAOƈقȂ createWorldVertexs ̃LbV𖳌ɂ܂
+		//         ێ̂ createWorldVertexs ̕ωô߂ŁA4x4 s ( 64 byte ) Ŏꍇ 1/4 Ȃ܂
+		const tnl::Affine& getWorldAffine();
+
 		// [hsŃgXtH[[hԒ_W̎擾
 		// tips... [0][1][2] ŎOp`P̒_W
-		std::vector<tnl::Vector3> createWorldVertexs();
+		//         ʂ̓LbV pos_ rot_ scl_ ǑĂяoωꍇ̂ݍČvZ܂
+		const std::vector<tnl::Vector3>& createWorldVertexs();
+
+		//-----------------------------------------------------------------------------------------------------
+		// Op` BVH ̍쐬
+		// arg1... LbVt@C̃pX ( ȗ )
+		// ret.... 쐬 BVH ( _Ȃ MV bV̏ꍇ nullptr )
+		// tips... LbVt@C݂΂ǂݍ݁A΍\zĕۑ܂
+		//         LbV݂̒_ECfbNXꂽłȂ΍\zď㏑܂
+		//         BVH ̓bṼ[JԂō\ẑ pos_ rot_ scl_ ύXĂ蒼Kv͂܂
+		Shared<tnl::TriangleBVH> createBVH(const std::string& cache_file_path = "");
+		inline Shared<tnl::TriangleBVH> getBVH() const noexcept { return bvh_; }
+
+		//-----------------------------------------------------------------------------------------------------
+		// CƃbV̍ŋߐڌ ( [h )
+		// arg1... CW
+		// arg2... CxNg
+		// arg3... _̎󂯎p ( ȗ )
+		// arg4... Op`ԍ̎󂯎p ( ȗ )
+		// ret.... [Փ˂Ă : true] [Փ˂ĂȂ : false]
+		// tips... BVH 쐬̏ꍇ̓LbVō쐬܂
+		bool isIntersectRay(const tnl::Vector3& pos, const tnl::Vector3& dir, tnl::Vector3* intersect_pos = nullptr, uint32_t* triangle_index = nullptr);
+
+		//-----------------------------------------------------------------------------------------------------
+		// ƃbV̍ŋߐڌ ( [h )
+		// arg1... n_
+		// arg2... I_
+		// arg3... n_ɍł߂_̎󂯎p ( ȗ )
+		// arg4... Op`ԍ̎󂯎p ( ȗ )
+		// ret.... [Փ˂Ă : true] [Փ˂ĂȂ : false]
+		bool isIntersectLine(const tnl::Vector3& s, const tnl::Vector3& e, tnl::Vector3* intersect_pos = nullptr, uint32_t* triangle_index = nullptr);
 
 
 		//==========================================================================================================================
@@ -476,6 +512,18 @@ namespace dxe {
 		eMeshFormat					mesh_format_ = eMeshFormat::MESH_FMT_PG;
 		eShapeType					shape_type_ = eShapeType::NONE;
 
+		// createWorldVertexs pLbV
+		// tips... local_vtxs_soa_ ͎Op`ɓWJ[JW [ x... ][ y... ][ z... ] Ŋi[
+		std::vector<float>			local_vtxs_soa_;
+		std::vector<float>			world_vtxs_soa_;
+		std::vector<tnl::Vector3>	world_vtxs_;
+		bool						is_world_vtxs_dirty_ = true;
+
+		// getWorldAffine ōŌɍ쐬[hϊ
+		tnl::Affine					world_;
+
+		Shared<tnl::TriangleBVH>	bvh_ = nullptr;
+
 		void createPlaneIndex(const int div_w, const int div_h, const bool is_left_cycle);
 		void createVBO();
 
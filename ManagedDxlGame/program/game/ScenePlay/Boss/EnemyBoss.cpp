@@ -391,8 +391,7 @@ void EnemyBoss::RenderBossHP() {
 
 void EnemyBoss::ShuffleBossHandProbabilityTable() {
 
-	std::random_device rd;
-	std::mt19937 gen(rd());
+	tnl::Rng& gen = tnl::Rng::Thread();
 
 	std::uniform_int_distribution<int> rateDistribution(1, 10);
 	int randomValue = rateDistribution(gen);
@@ -16,6 +16,7 @@
 // Q[NɂPxs܂
 void gameStart(){
 	srand(time(0));
+	tnl::Rng::SetSeed(static_cast<uint64_t>(time(0)));
 	SetFontSize(30);
 
 	tnl::AddFontTTF("font/genkai-mincho.ttf");
@@ -25,6 +25,11 @@
 #include <cstdlib>
 #include <cstdio>
 #include <limits>
+#include <algorithm>
+#include <cstring>
+#include <bit>
+#include <charconv>
+#include "tnl_simd.h"
 
 namespace json11 {
 
@@ -571,6 +576,22 @@ struct JsonParser final {
      * Parse a double.
      */
     Json parse_number() {
+        bool is_int = false;
+        int int_value = 0;
+        double double_value = 0;
+        if (!parse_number_value(is_int, int_value, double_value))
+            return Json();
+        if (is_int)
+            return int_value;
+        return double_value;
+    }
+
+    /* parse_number_value(is_int, int_value, double_value)
+     *
+     * Parse a number without building a Json. Numbers short enough to fit an int are
+     * returned through int_value, the others through double_value.
+     */
+    bool parse_number_value(bool &is_int, int &int_value, double &double_value) {
         size_t start_pos = i;
 
         if (str[i] == '-')
@@ -580,25 +601,27 @@ struct JsonParser final {
         if (str[i] == '0') {
             i++;
             if (in_range(str[i], '0', '9'))
-                return fail("leading 0s not permitted in numbers");
+                return fail("leading 0s not permitted in numbers", false);
         } else if (in_range(str[i], '1', '9')) {
             i++;
             while (in_range(str[i], '0', '9'))
                 i++;
         } else {
-            return fail("invalid " + esc(str[i]) + " in number");
+            return fail("invalid " + esc(str[i]) + " in number", false);
         }
 
         if (str[i] != '.' && str[i] != 'e' && str[i] != 'E'
                 && (i - start_pos) <= static_cast<size_t>(std::numeric_limits<int>::digits10)) {
-            return std::atoi(str.c_str() + start_pos);
+            is_int = true;
+            int_value = std::atoi(str.c_str() + start_pos);
+            return true;
         }
 
         // Decimal part
         if (str[i] == '.') {
             i++;
             if (!in_range(str[i], '0', '9'))
-                return fail("at least one digit required in fractional part");
+                return fail("at least one digit required in fractional part", false);
 
             while (in_range(str[i], '0', '9'))
                 i++;
@@ -612,13 +635,15 @@ struct JsonParser final {
                 i++;
 
             if (!in_range(str[i], '0', '9'))
-                return fail("at least one digit required in exponent");
+                return fail("at least one digit required in exponent", false);
 
             while (in_range(str[i], '0', '9'))
                 i++;
         }
 
-        return std::strtod(str.c_str() + start_pos, nullptr);
+        is_int = false;
+        double_value = std::strtod(str.c_str() + start_pos, nullptr);
+        return true;
     }
 
     /* expect(str, res)
@@ -627,13 +652,19 @@ struct JsonParser final {
      * the input and return res. If not, flag an error.
      */
     Json expect(const string &expected, Json res) {
+        if (expect_literal(expected))
+            return res;
+        return Json();
+    }
+
+    bool expect_literal(const string &expected) {
         assert(i != 0);
         i--;
         if (str.compare(i, expected.length(), expected) == 0) {
             i += expected.length();
-            return res;
+            return true;
         } else {
-            return fail("parse error: expected " + expected + ", got " + str.substr(i, expected.length()));
+            return fail("parse error: expected " + expected + ", got " + str.substr(i, expected.length()), false);
         }
     }
 
@@ -726,10 +757,778 @@ struct JsonParser final {
 
         return fail("expected value, got " + esc(ch));
     }
+
+    /* parse_string_view(out, scratch)
+     *
+     * Parse a string, starting at the current position. Strings without escapes are
+     * returned as a view into the input; the others are decoded into scratch by
+     * parse_string(), so errors are reported exactly as for the DOM parser.
+     */
+    bool parse_string_view(std::string_view &out, string &scratch) {
+        const size_t start_pos = i;
+        for (size_t j = i; j < str.size(); j++) {
+            const uint8_t ch = static_cast<uint8_t>(str[j]);
+            if (ch == '"') {
+                out = std::string_view(str.data() + start_pos, j - start_pos);
+                i = j + 1;
+                return true;
+            }
+            if (ch == '\\' || ch <= 0x1f)
+                break;
+        }
+        scratch = parse_string();
+        out = scratch;
+        return !failed;
+    }
+
+    /* parse_events(depth, handler)
+     *
+     * Parse a JSON value and report it to handler as a sequence of events instead of
+     * building a Json. Follows parse_json() step for step so that the same input fails at
+     * the same position with the same message.
+     */
+    template <typename Handler>
+    bool parse_events(int depth, Handler &handler, string &scratch) {
+        if (depth > max_depth)
+            return fail("exceeded maximum nesting depth", false);
+
+        char ch = get_next_token();
+        if (failed)
+            return false;
+
+        if (ch == '-' || (ch >= '0' && ch <= '9')) {
+            i--;
+            bool is_int = false;
+            int int_value = 0;
+            double double_value = 0;
+            if (!parse_number_value(is_int, int_value, double_value))
+                return false;
+            return handled(is_int ? handler.int_value(int_value) : handler.number_value(double_value));
+        }
+
+        if (ch == 't')
+            return expect_literal("true") && handled(handler.bool_value(true));
+
+        if (ch == 'f')
+            return expect_literal("false") && handled(handler.bool_value(false));
+
+        if (ch == 'n')
+            return expect_literal("null") && handled(handler.null_value());
+
+        if (ch == '"') {
+            std::string_view value;
+            return parse_string_view(value, scratch) && handled(handler.string_value(value));
+        }
+
+        if (ch == '{') {
+            if (!handled(handler.start_object()))
+                return false;
+            ch = get_next_token();
+            if (ch == '}')
+                return handled(handler.end_object());
+
+            while (1) {
+                if (ch != '"')
+                    return fail("expected '\"' in object, got " + esc(ch), false);
+
+                std::string_view key;
+                if (!parse_string_view(key, scratch))
+                    return false;
+
+                ch = get_next_token();
+                if (ch != ':')
+                    return fail("expected ':' in object, got " + esc(ch), false);
+
+                if (!handled(handler.key(key)))
+                    return false;
+                if (!parse_events(depth + 1, handler, scratch))
+                    return false;
+
+                ch = get_next_token();
+                if (ch == '}')
+                    break;
+                if (ch != ',')
+                    return fail("expected ',' in object, got " + esc(ch), false);
+
+                ch = get_next_token();
+            }
+            return handled(handler.end_object());
+        }
+
+        if (ch == '[') {
+            if (!handled(handler.start_array()))
+                return false;
+            ch = get_next_token();
+            if (ch == ']')
+                return handled(handler.end_array());
+
+            while (1) {
+                i--;
+                if (!parse_events(depth + 1, handler, scratch))
+                    return false;
+
+                ch = get_next_token();
+                if (ch == ']')
+                    break;
+                if (ch != ',')
+                    return fail("expected ',' in list, got " + esc(ch), false);
+
+                ch = get_next_token();
+                (void)ch;
+            }
+            return handled(handler.end_array());
+        }
+
+        return fail("expected value, got " + esc(ch), false);
+    }
+
+    bool handled(bool accepted) {
+        if (!accepted)
+            return fail("parse aborted by handler", false);
+        return true;
+    }
+
+    /* parse_events_root(handler)
+     *
+     * parse_events() for a whole input, with the same trailing garbage check as Json::parse.
+     */
+    template <typename Handler>
+    bool parse_events_root(Handler &handler) {
+        string scratch;
+        parse_events(0, handler, scratch);
+
+        // Check for any trailing garbage
+        consume_garbage();
+        if (failed)
+            return false;
+        if (i != str.size())
+            return fail("unexpected trailing " + esc(str[i]), false);
+        return true;
+    }
+};
+}//namespace {
+
+/* JsonDocumentBuilder
+ *
+ * parse_events() handler that lays a JsonDocument out in its arena. Finished values are
+ * kept on a stack until their container closes, then copied into the arena in one block.
+ */
+struct JsonDocumentBuilder final {
+    struct Frame {
+        size_t start;
+        std::string_view key;   // key of the container itself when it is an object member
+    };
+
+    JsonDocument &doc;
+    vector<JsonMember> stack;
+    vector<Frame> frames;
+    std::string_view pending_key;
+
+    void push(const JsonNode &node) {
+        stack.push_back({ pending_key, node });
+        pending_key = std::string_view();
+    }
+
+    std::string_view copy_string(std::string_view s) {
+        char *chars = static_cast<char *>(doc.allocate(s.size() + 1, 1));
+        if (!s.empty())
+            memcpy(chars, s.data(), s.size());
+        chars[s.size()] = '\0';
+        return std::string_view(chars, s.size());
+    }
+
+    bool null_value() { JsonNode node {}; node.type = Json::NUL; push(node); return true; }
+    bool bool_value(bool value) { JsonNode node {}; node.type = Json::BOOL; node.boolean = value; push(node); return true; }
+    bool int_value(int value) { JsonNode node {}; node.type = Json::INT; node.int_number = value; push(node); return true; }
+    bool number_value(double value) { JsonNode node {}; node.type = Json::DOUBLE; node.number = value; push(node); return true; }
+
+    bool string_value(std::string_view value) {
+        JsonNode node {};
+        node.type = Json::STRING;
+        const std::string_view s = copy_string(value);
+        node.chars = s.data();
+        node.size = static_cast<uint32_t>(s.size());
+        push(node);
+        return true;
+    }
+
+    bool key(std::string_view key) {
+        pending_key = copy_string(key);
+        return true;
+    }
+
+    bool start_object() { return start_container(); }
+    bool start_array() { return start_container(); }
+
+    bool start_container() {
+        frames.push_back({ stack.size(), pending_key });
+        pending_key = std::string_view();
+        return true;
+    }
+
+    bool end_array() {
+        const Frame frame = frames.back();
+        frames.pop_back();
+        const size_t count = stack.size() - frame.start;
+        JsonNode *items = static_cast<JsonNode *>(doc.allocate(sizeof(JsonNode) * count, alignof(JsonNode)));
+        for (size_t n = 0; n < count; n++)
+            items[n] = stack[frame.start + n].value;
+        stack.resize(frame.start);
+
+        JsonNode node {};
+        node.type = Json::ARRAY;
+        node.items = items;
+        node.size = static_cast<uint32_t>(count);
+        pending_key = frame.key;
+        push(node);
+        return true;
+    }
+
+    bool end_object() {
+        const Frame frame = frames.back();
+        frames.pop_back();
+
+        // Sort by key; on duplicate keys the last one wins, as with std::map assignment.
+        // Typical objects are small, where an insertion sort avoids stable_sort's buffer.
+        const auto less = [](const JsonMember &a, const JsonMember &b) { return a.key < b.key; };
+        if (stack.size() - frame.start <= 32) {
+            for (size_t n = frame.start + 1; n < stack.size(); n++) {
+                JsonMember member = stack[n];
+                size_t m = n;
+                for (; m > frame.start && less(member, stack[m - 1]); m--)
+                    stack[m] = stack[m - 1];
+                stack[m] = member;
+            }
+        } else {
+            std::stable_sort(stack.begin() + frame.start, stack.end(), less);
+        }
+        size_t count = 0;
+        for (size_t n = frame.start; n < stack.size(); n++) {
+            if (n + 1 < stack.size() && stack[n + 1].key == stack[n].key)
+                continue;
+            stack[frame.start + count++] = stack[n];
+        }
+        JsonMember *members = static_cast<JsonMember *>(doc.allocate(sizeof(JsonMember) * count, alignof(JsonMember)));
+        for (size_t n = 0; n < count; n++)
+            members[n] = stack[frame.start + n];
+        stack.resize(frame.start);
+
+        JsonNode node {};
+        node.type = Json::OBJECT;
+        node.members = members;
+        node.size = static_cast<uint32_t>(count);
+        pending_key = frame.key;
+        push(node);
+        return true;
+    }
+};
+
+namespace {
+/* JsonHandlerAdapter
+ *
+ * Forwards parse_events() to a user JsonHandler.
+ */
+struct JsonHandlerAdapter final {
+    JsonHandler &handler;
+    bool null_value() { return handler.null_value(); }
+    bool bool_value(bool value) { return handler.bool_value(value); }
+    bool int_value(int value) { return handler.int_value(value); }
+    bool number_value(double value) { return handler.number_value(value); }
+    bool string_value(std::string_view value) { return handler.string_value(value); }
+    bool start_object() { return handler.start_object(); }
+    bool key(std::string_view key) { return handler.key(key); }
+    bool end_object() { return handler.end_object(); }
+    bool start_array() { return handler.start_array(); }
+    bool end_array() { return handler.end_array(); }
+};
+
+/* * * * * * * * * * * * * * * * * * * *
+ * Structural backend
+ *
+ * Stage 1 (JsonStructuralIndex) classifies the input 64 bytes at a time into bitmasks
+ * and finds where every token starts. Stage 2 (JsonStructuralParser) walks those positions
+ * instead of the bytes, so whitespace and string contents are never looked at one by one.
+ * Anything stage 2 does not accept is left to JsonParser so that results and error
+ * messages stay exactly the same.
+ */
+
+// Bitmasks for one 64-byte block, bit n = byte n
+struct JsonBlockMasks {
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t structural;    // { } [ ] : ,
+    uint64_t whitespace;    // ' ' \t \n \r
+    uint64_t control;       // < 0x20
+};
+
+static inline void classify_block(const char *p, JsonBlockMasks &m) {
+#if defined(TNL_SIMD_AVX2)
+    m = {};
+    for (int half = 0; half < 2; half++) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + half * 32));
+        const __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));   // [ -> {, ] -> }
+        const auto bits = [](__m256i x) { return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(x))); };
+        const int shift = half * 32;
+        m.quote |= bits(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"'))) << shift;
+        m.backslash |= bits(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))) << shift;
+        m.structural |= bits(_mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(lower, _mm256_set1_epi8('{')), _mm256_cmpeq_epi8(lower, _mm256_set1_epi8('}'))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(':')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8(','))))) << shift;
+        m.whitespace |= bits(_mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t'))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r'))))) << shift;
+        m.control |= bits(_mm256_cmpeq_epi8(_mm256_max_epu8(v, _mm256_set1_epi8(0x1f)), _mm256_set1_epi8(0x1f))) << shift;
+    }
+#elif defined(TNL_SIMD_SSE)
+    m = {};
+    for (int quarter = 0; quarter < 4; quarter++) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + quarter * 16));
+        const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+        const auto bits = [](__m128i x) { return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(x))); };
+        const int shift = quarter * 16;
+        m.quote |= bits(_mm_cmpeq_epi8(v, _mm_set1_epi8('"'))) << shift;
+        m.backslash |= bits(_mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))) << shift;
+        m.structural |= bits(_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(lower, _mm_set1_epi8('{')), _mm_cmpeq_epi8(lower, _mm_set1_epi8('}'))),
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(':')), _mm_cmpeq_epi8(v, _mm_set1_epi8(','))))) << shift;
+        m.whitespace |= bits(_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))))) << shift;
+        m.control |= bits(_mm_cmpeq_epi8(_mm_max_epu8(v, _mm_set1_epi8(0x1f)), _mm_set1_epi8(0x1f))) << shift;
+    }
+#else
+    m = {};
+    for (int n = 0; n < 64; n++) {
+        const uint8_t ch = static_cast<uint8_t>(p[n]);
+        const uint64_t bit = 1ull << n;
+        if (ch == '"') m.quote |= bit;
+        if (ch == '\\') m.backslash |= bit;
+        if (ch == '{' || ch == '}' || ch == '[' || ch == ']' || ch == ':' || ch == ',') m.structural |= bit;
+        if (ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r') m.whitespace |= bit;
+        if (ch <= 0x1f) m.control |= bit;
+    }
+#endif
+}
+
+// Bit n set when byte n is escaped by a backslash. Backslashes are rare in data files, so
+// they are walked one by one; carry is set when the block ends with an escaping backslash.
+static inline uint64_t escaped_mask(uint64_t backslash, uint64_t &carry) {
+    uint64_t escaped = carry;
+    carry = 0;
+    while (backslash) {
+        const int n = std::countr_zero(backslash);
+        backslash &= backslash - 1;
+        if (escaped & (1ull << n))
+            continue;
+        if (n == 63)
+            carry = 1;
+        else
+            escaped |= 1ull << (n + 1);
+    }
+    return escaped;
+}
+
+// Bit n = parity of the set bits at or below n (inside a string from the opening quote on)
+static inline uint64_t prefix_xor(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+/* JsonStructuralIndex
+ *
+ * Stage 1. Yields the position of every structural character outside strings, every
+ * unescaped quote and the first byte of every other token, then in.size() once the input
+ * is used up. The input is classified one window at a time so that the positions stay in
+ * cache however large the input is.
+ */
+struct JsonStructuralIndex final {
+    static constexpr size_t window_blocks = 256;
+
+    const string &in;
+    vector<uint32_t> positions;
+    size_t count = 0;
+    size_t k = 0;
+    size_t base = 0;                        // first byte not classified yet
+    size_t first_backslash = string::npos;
+    size_t first_control = string::npos;    // first control character inside a string
+    uint64_t escape_carry = 0;
+    uint64_t in_string_carry = 0;           // all ones while inside a string
+    uint64_t token_carry = 0;               // 1 when the previous block ended inside a token
+
+    explicit JsonStructuralIndex(const string &in) : in(in), positions(window_blocks * 64) {}
+
+    uint32_t peek() {
+        if (k == count)
+            refill();
+        return positions[k];
+    }
+
+    uint32_t next() {
+        const uint32_t p = peek();
+        k++;
+        return p;
+    }
+
+    void refill() {
+        k = 0;
+        count = 0;
+        while (count == 0) {
+            if (base >= in.size()) {
+                positions[count++] = static_cast<uint32_t>(in.size());
+                return;
+            }
+            for (size_t n = 0; n < window_blocks && base < in.size(); n++, base += 64)
+                classify(base);
+        }
+    }
+
+    void classify(size_t block) {
+        JsonBlockMasks m;
+        if (block + 64 <= in.size()) {
+            classify_block(in.data() + block, m);
+        } else {
+            // Pad the last block with whitespace
+            char padded[64];
+            memset(padded, ' ', sizeof padded);
+            memcpy(padded, in.data() + block, in.size() - block);
+            classify_block(padded, m);
+        }
+
+        uint64_t escaped = 0;
+        if (m.backslash || escape_carry) {
+            if (first_backslash == string::npos && m.backslash)
+                first_backslash = block + std::countr_zero(m.backslash);
+            escaped = escaped_mask(m.backslash, escape_carry);
+        }
+        const uint64_t quote = m.quote & ~escaped;
+        const uint64_t in_string = prefix_xor(quote) ^ in_string_carry;
+        in_string_carry = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+        if ((m.control & in_string) && first_control == string::npos)
+            first_control = block + std::countr_zero(m.control & in_string);
+
+        const uint64_t token = ~(m.structural | m.whitespace | quote | in_string);
+        const uint64_t token_start = token & ~((token << 1) | token_carry);
+        token_carry = token >> 63;
+
+        uint32_t *out = positions.data() + count;
+        uint64_t bits = (m.structural & ~in_string) | quote | token_start;
+        count += std::popcount(bits);
+        while (bits) {
+            *out++ = static_cast<uint32_t>(block + std::countr_zero(bits));
+            bits &= bits - 1;
+        }
+    }
+};
+
+/* JsonStructuralParser
+ *
+ * Stage 2. Walks the positions from stage 1 and reports events to handler in the same
+ * order as parse_events(). Numbers and escaped strings are read by JsonParser itself so
+ * their values are identical. It gives up on anything parse_events() would reject, and
+ * also on some input parse_events() reports part of before failing (such as "1x"), so the
+ * events reported are always a prefix of those parse_events() reports.
+ */
+template <typename Handler>
+struct JsonStructuralParser final {
+    const string &str;
+    JsonStructuralIndex &index;
+    Handler &handler;
+    string scratch;
+    size_t events = 0;
+    bool aborted = false;
+
+    bool handled(bool accepted) {
+        events++;
+        aborted = !accepted;
+        return accepted;
+    }
+
+    bool at(char ch) {
+        const size_t p = index.peek();
+        return p < str.size() && str[p] == ch;
+    }
+
+    bool parse_root() {
+        return parse_value(0) && index.peek() == str.size();
+    }
+
+    bool parse_value(int depth) {
+        const size_t p = index.peek();
+        if (depth > max_depth || p >= str.size())
+            return false;
+
+        const char ch = str[p];
+        if (ch == '"') {
+            std::string_view value;
+            return parse_string(value) && handled(handler.string_value(value));
+        }
+
+        if (ch == '{') {
+            index.next();
+            if (!handled(handler.start_object()))
+                return false;
+            if (at('}')) {
+                index.next();
+                return handled(handler.end_object());
+            }
+            while (1) {
+                std::string_view key;
+                if (!at('"') || !parse_string(key))
+                    return false;
+                if (!at(':'))
+                    return false;
+                index.next();
+                if (!handled(handler.key(key)))
+                    return false;
+                if (!parse_value(depth + 1))
+                    return false;
+                if (at('}'))
+                    break;
+                if (!at(','))
+                    return false;
+                index.next();
+            }
+            index.next();
+            return handled(handler.end_object());
+        }
+
+        if (ch == '[') {
+            index.next();
+            if (!handled(handler.start_array()))
+                return false;
+            if (at(']')) {
+                index.next();
+                return handled(handler.end_array());
+            }
+            while (1) {
+                if (!parse_value(depth + 1))
+                    return false;
+                if (at(']'))
+                    break;
+                if (!at(','))
+                    return false;
+                index.next();
+            }
+            index.next();
+            return handled(handler.end_array());
+        }
+
+        index.next();
+        return parse_token(p);
+    }
+
+    // Opening quote and closing quote are consecutive positions
+    bool parse_string(std::string_view &out) {
+        const size_t open = index.next();
+        const size_t close = index.next();
+        if (close >= str.size() || close > index.first_control)
+            return false;
+
+        if (index.first_backslash < close && memchr(str.data() + open + 1, '\\', close - open - 1)) {
+            string err;
+            JsonParser parser { str, open + 1, err, false, JsonParse::STANDARD };
+            return parser.parse_string_view(out, scratch) && parser.i == close + 1;
+        }
+        out = std::string_view(str.data() + open + 1, close - open - 1);
+        return true;
+    }
+
+    // Literal or number starting at p; it must end exactly where the token ends. Whitespace
+    // inside a token would have started another one, so the token runs up to the next
+    // position less any whitespace in between.
+    bool parse_token(size_t p) {
+        size_t end = index.peek();
+        while (end > p && (str[end - 1] == ' ' || str[end - 1] == '\t' || str[end - 1] == '\n' || str[end - 1] == '\r'))
+            end--;
+
+        const char ch = str[p];
+        if (ch == 't' || ch == 'f' || ch == 'n') {
+            const char *literal = (ch == 't') ? "true" : (ch == 'f') ? "false" : "null";
+            const size_t length = (ch == 'f') ? 5 : 4;
+            if (end - p != length || memcmp(str.data() + p, literal, length) != 0)
+                return false;
+            return handled((ch == 'n') ? handler.null_value() : handler.bool_value(ch == 't'));
+        }
+
+        bool is_int = false;
+        int int_value = 0;
+        double double_value = 0;
+        if (!parse_number(p, end, is_int, int_value, double_value))
+            return false;
+        return handled(is_int ? handler.int_value(int_value) : handler.number_value(double_value));
+    }
+
+    /* parse_number(p, end, is_int, int_value, double_value)
+     *
+     * Same grammar and the same int / double split as JsonParser::parse_number_value(), but
+     * with the digits converted here and from_chars in place of strtod (both are correctly
+     * rounded). Out of range values are still left to strtod.
+     */
+    bool parse_number(size_t p, size_t end, bool &is_int, int &int_value, double &double_value) {
+        const char *first = str.data() + p;
+        const char *last = str.data() + end;
+        const char *c = first;
+        const bool negative = (c < last && *c == '-');
+        if (negative)
+            c++;
+
+        // Integer part
+        if (c == last || !in_range(*c, '0', '9'))
+            return false;
+        if (*c == '0' && c + 1 < last && in_range(c[1], '0', '9'))
+            return false;
+        uint32_t value = 0;     // only used when it has few enough digits not to wrap
+        while (c < last && in_range(*c, '0', '9'))
+            value = value * 10 + static_cast<uint32_t>(*c++ - '0');
+
+        if (c == last && (last - first) <= std::numeric_limits<int>::digits10) {
+            is_int = true;
+            int_value = negative ? -static_cast<int>(value) : static_cast<int>(value);
+            return true;
+        }
+
+        // Decimal part
+        if (c < last && *c == '.') {
+            c++;
+            if (c == last || !in_range(*c, '0', '9'))
+                return false;
+            while (c < last && in_range(*c, '0', '9'))
+                c++;
+        }
+
+        // Exponent part
+        if (c < last && (*c == 'e' || *c == 'E')) {
+            c++;
+            if (c < last && (*c == '+' || *c == '-'))
+                c++;
+            if (c == last || !in_range(*c, '0', '9'))
+                return false;
+            while (c < last && in_range(*c, '0', '9'))
+                c++;
+        }
+        if (c != last)
+            return false;
+
+        is_int = false;
+        const std::from_chars_result result = std::from_chars(first, last, double_value);
+        if (result.ec != std::errc() || result.ptr != last)
+            double_value = std::strtod(first, nullptr);
+        return true;
+    }
+};
+
+enum class StructuralResult {
+    DONE, ABORTED, FALLBACK
+};
+
+/* parse_structural(in, handler, events)
+ *
+ * Run stages 1 and 2 over in. FALLBACK means the caller must parse the input with
+ * JsonParser instead; events is then the number of events already reported to handler.
+ */
+template <typename Handler>
+static StructuralResult parse_structural(const string &in, Handler &handler, size_t &events) {
+    events = 0;
+    if (in.size() >= 0xffffffffu)
+        return StructuralResult::FALLBACK;
+
+    JsonStructuralIndex index { in };
+    JsonStructuralParser<Handler> parser { in, index, handler, string() };
+    const bool done = parser.parse_root();
+    events = parser.events;
+    if (parser.aborted)
+        return StructuralResult::ABORTED;
+    return done ? StructuralResult::DONE : StructuralResult::FALLBACK;
+}
+
+/* JsonSkipEvents
+ *
+ * Forwards events to handler except for the first skip of them, which the structural
+ * backend has already reported.
+ */
+template <typename Handler>
+struct JsonSkipEvents final {
+    Handler &handler;
+    size_t skip;
+
+    bool skipped() {
+        if (skip == 0)
+            return false;
+        skip--;
+        return true;
+    }
+
+    bool null_value() { return skipped() || handler.null_value(); }
+    bool bool_value(bool value) { return skipped() || handler.bool_value(value); }
+    bool int_value(int value) { return skipped() || handler.int_value(value); }
+    bool number_value(double value) { return skipped() || handler.number_value(value); }
+    bool string_value(std::string_view value) { return skipped() || handler.string_value(value); }
+    bool start_object() { return skipped() || handler.start_object(); }
+    bool key(std::string_view key) { return skipped() || handler.key(key); }
+    bool end_object() { return skipped() || handler.end_object(); }
+    bool start_array() { return skipped() || handler.start_array(); }
+    bool end_array() { return skipped() || handler.end_array(); }
+};
+
+/* JsonValueBuilder
+ *
+ * Handler that builds a regular Json from events, with the same duplicate key handling
+ * as parse_json().
+ */
+struct JsonValueBuilder final {
+    struct Frame {
+        size_t value_start;
+        size_t key_start;
+    };
+    vector<Json> values;
+    vector<string> keys;
+    vector<Frame> frames;
+
+    bool null_value() { values.emplace_back(); return true; }
+    bool bool_value(bool value) { values.emplace_back(value); return true; }
+    bool int_value(int value) { values.emplace_back(value); return true; }
+    bool number_value(double value) { values.emplace_back(value); return true; }
+    bool string_value(std::string_view value) { values.emplace_back(string(value)); return true; }
+    bool key(std::string_view key) { keys.emplace_back(key); return true; }
+    bool start_object() { frames.push_back({ values.size(), keys.size() }); return true; }
+    bool start_array() { frames.push_back({ values.size(), keys.size() }); return true; }
+
+    bool end_object() {
+        const Frame frame = frames.back();
+        frames.pop_back();
+        map<string, Json> data;
+        for (size_t n = 0; frame.value_start + n < values.size(); n++)
+            data[std::move(keys[frame.key_start + n])] = std::move(values[frame.value_start + n]);
+        values.resize(frame.value_start);
+        keys.resize(frame.key_start);
+        values.emplace_back(std::move(data));
+        return true;
+    }
+
+    bool end_array() {
+        const Frame frame = frames.back();
+        frames.pop_back();
+        vector<Json> data(std::make_move_iterator(values.begin() + frame.value_start), std::make_move_iterator(values.end()));
+        values.resize(frame.value_start);
+        values.emplace_back(std::move(data));
+        return true;
+    }
 };
 }//namespace {
 
-Json Json::parse(const string &in, string &err, JsonParse strategy) {
+Json Json::parse(const string &in, string &err, JsonParse strategy, JsonBackend backend) {
+    if (backend == JsonBackend::STRUCTURAL && strategy == JsonParse::STANDARD) {
+        JsonValueBuilder builder;
+        size_t events = 0;
+        if (parse_structural(in, builder, events) == StructuralResult::DONE)
+            return std::move(builder.values.back());
+    }
+
     JsonParser parser { in, 0, err, false, strategy };
     Json result = parser.parse_json(0);
 
@@ -743,6 +1542,24 @@ Json Json::parse(const string &in, string &err, JsonParse strategy) {
     return result;
 }
 
+bool Json::parse(const string &in, JsonHandler &handler, string &err, JsonParse strategy, JsonBackend backend) {
+    JsonParser parser { in, 0, err, false, strategy };
+    JsonHandlerAdapter adapter { handler };
+    if (backend == JsonBackend::STRUCTURAL && strategy == JsonParse::STANDARD) {
+        size_t events = 0;
+        const StructuralResult result = parse_structural(in, adapter, events);
+        if (result == StructuralResult::DONE)
+            return true;
+        if (result == StructuralResult::ABORTED)
+            return parser.fail("parse aborted by handler", false);
+
+        // Carry on from where the structural backend gave up
+        JsonSkipEvents<JsonHandlerAdapter> skipper { adapter, events };
+        return parser.parse_events_root(skipper);
+    }
+    return parser.parse_events_root(adapter);
+}
+
 // Documented in json11.hpp
 vector<Json> Json::parse_multi(const string &in,
                                std::string::size_type &parser_stop_pos,
@@ -765,6 +1582,133 @@ vector<Json> Json::parse_multi(const string &in,
     return json_vec;
 }
 
+/* * * * * * * * * * * * * * * * * * * *
+ * JsonDocument
+ */
+
+static const JsonNode null_node {};
+
+JsonDocument::JsonDocument() noexcept : m_head(nullptr), m_remain(0), m_reserved(0), m_root() {}
+
+JsonDocument JsonDocument::parse(const string &in, string &err, JsonParse strategy, JsonBackend backend) {
+    JsonDocument doc;
+    // Blocks are sized from the input so that a document takes only a few of them
+    doc.m_next_block = std::max<size_t>(in.size(), 4096);
+
+    if (backend == JsonBackend::STRUCTURAL && strategy == JsonParse::STANDARD) {
+        JsonDocumentBuilder builder { doc, {}, {}, std::string_view() };
+        size_t events = 0;
+        if (parse_structural(in, builder, events) == StructuralResult::DONE) {
+            doc.m_root = builder.stack.back().value;
+            return doc;
+        }
+
+        // It may have written to the arena before giving up
+        doc = JsonDocument();
+        doc.m_next_block = std::max<size_t>(in.size(), 4096);
+    }
+
+    JsonParser parser { in, 0, err, false, strategy };
+    JsonDocumentBuilder builder { doc, {}, {}, std::string_view() };
+    if (!parser.parse_events_root(builder) || builder.stack.empty())
+        return JsonDocument();
+    doc.m_root = builder.stack.back().value;
+    return doc;
+}
+
+void * JsonDocument::allocate(size_t size, size_t align) {
+    size_t pad = (align - (reinterpret_cast<uintptr_t>(m_head) & (align - 1))) & (align - 1);
+    if (!m_head || pad + size > m_remain) {
+        const size_t block = std::max(m_next_block, size + align);
+        m_blocks.emplace_back(new char[block]);
+        m_head = m_blocks.back().get();
+        m_remain = block;
+        m_reserved += block;
+        pad = (align - (reinterpret_cast<uintptr_t>(m_head) & (align - 1))) & (align - 1);
+    }
+    void *p = m_head + pad;
+    m_head += pad + size;
+    m_remain -= pad + size;
+    return p;
+}
+
+Json::Type JsonElement::type() const {
+    return m_node ? m_node->type : Json::NUL;
+}
+
+double JsonElement::number_value() const {
+    if (!m_node) return 0;
+    if (m_node->type == Json::DOUBLE) return m_node->number;
+    if (m_node->type == Json::INT) return m_node->int_number;
+    return 0;
+}
+
+int JsonElement::int_value() const {
+    if (!m_node) return 0;
+    if (m_node->type == Json::INT) return m_node->int_number;
+    if (m_node->type == Json::DOUBLE) return static_cast<int>(m_node->number);
+    return 0;
+}
+
+bool JsonElement::bool_value() const {
+    return m_node && m_node->type == Json::BOOL && m_node->boolean;
+}
+
+std::string_view JsonElement::string_value() const {
+    if (!m_node || m_node->type != Json::STRING) return std::string_view();
+    return std::string_view(m_node->chars, m_node->size);
+}
+
+size_t JsonElement::size() const {
+    if (!m_node || (m_node->type != Json::ARRAY && m_node->type != Json::OBJECT)) return 0;
+    return m_node->size;
+}
+
+JsonElement JsonElement::operator[](size_t i) const {
+    if (i >= size()) return JsonElement(&null_node);
+    if (m_node->type == Json::ARRAY) return JsonElement(&m_node->items[i]);
+    return JsonElement(&m_node->members[i].value);
+}
+
+JsonElement JsonElement::operator[](std::string_view key) const {
+    if (!m_node || m_node->type != Json::OBJECT) return JsonElement(&null_node);
+    const JsonMember *begin = m_node->members;
+    const JsonMember *end = begin + m_node->size;
+    const JsonMember *it = std::lower_bound(begin, end, key, [](const JsonMember &m, std::string_view k) {
+        return m.key < k;
+    });
+    if (it == end || it->key != key) return JsonElement(&null_node);
+    return JsonElement(&it->value);
+}
+
+std::string_view JsonElement::key(size_t i) const {
+    if (!m_node || m_node->type != Json::OBJECT || i >= m_node->size) return std::string_view();
+    return m_node->members[i].key;
+}
+
+Json JsonElement::to_json() const {
+    switch (type()) {
+    case Json::INT: return m_node->int_number;
+    case Json::DOUBLE: return m_node->number;
+    case Json::BOOL: return m_node->boolean;
+    case Json::STRING: return string(string_value());
+    case Json::ARRAY: {
+        Json::array items;
+        items.reserve(m_node->size);
+        for (size_t n = 0; n < m_node->size; n++)
+            items.push_back(JsonElement(&m_node->items[n]).to_json());
+        return items;
+    }
+    case Json::OBJECT: {
+        Json::object items;
+        for (size_t n = 0; n < m_node->size; n++)
+            items.emplace_hint(items.end(), string(m_node->members[n].key), JsonElement(&m_node->members[n].value).to_json());
+        return items;
+    }
+    default: return Json();
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * *
  * Shape-checking
  */
@@ -50,7 +50,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 #include <memory>
@@ -74,7 +76,20 @@ enum JsonParse {
     STANDARD, COMMENTS
 };
 
+/* JsonBackend
+ *
+ * SCALAR reads the input one character at a time. STRUCTURAL first finds every structural
+ * character, quote and value start of the input 64 bytes at a time (AVX2 / SSE, or a scalar
+ * fallback), then parses by walking those positions. Both give identical values, handler
+ * events and error messages: STRUCTURAL hands input it does not accept over to SCALAR, and
+ * COMMENTS input is always parsed by SCALAR.
+ */
+enum class JsonBackend {
+    SCALAR, STRUCTURAL
+};
+
 class JsonValue;
+class JsonHandler;
 
 class Json final {
 public:
@@ -164,17 +179,27 @@ public:
     // Parse. If parse fails, return Json() and assign an error message to err.
     static Json parse(const std::string & in,
                       std::string & err,
-                      JsonParse strategy = JsonParse::STANDARD);
+                      JsonParse strategy = JsonParse::STANDARD,
+                      JsonBackend backend = JsonBackend::SCALAR);
     static Json parse(const char * in,
                       std::string & err,
-                      JsonParse strategy = JsonParse::STANDARD) {
+                      JsonParse strategy = JsonParse::STANDARD,
+                      JsonBackend backend = JsonBackend::SCALAR) {
         if (in) {
-            return parse(std::string(in), err, strategy);
+            return parse(std::string(in), err, strategy, backend);
         } else {
             err = "null input";
             return nullptr;
         }
     }
+    // Parse without building a tree: report each value to handler as it is read (SAX mode).
+    // Returns false and assigns an error message to err on failure; the messages are the
+    // same as for the DOM parse. Values already reported before the error are not undone.
+    static bool parse(const std::string & in,
+                      JsonHandler & handler,
+                      std::string & err,
+                      JsonParse strategy = JsonParse::STANDARD,
+                      JsonBackend backend = JsonBackend::SCALAR);
     // Parse multiple objects, concatenated or separated by whitespace
     static std::vector<Json> parse_multi(
         const std::string & in,
@@ -230,4 +255,128 @@ protected:
     virtual ~JsonValue() {}
 };
 
+/* JsonHandler
+ *
+ * Callbacks for the SAX mode of Json::parse. Every callback returns true to continue; returning
+ * false stops the parse with the error "parse aborted by handler". Object members are reported
+ * as key() followed by the value. String views are only valid during the call.
+ */
+class JsonHandler {
+public:
+    virtual ~JsonHandler() {}
+    virtual bool null_value() { return true; }
+    virtual bool bool_value(bool) { return true; }
+    virtual bool int_value(int) { return true; }
+    virtual bool number_value(double) { return true; }
+    virtual bool string_value(std::string_view) { return true; }
+    virtual bool start_object() { return true; }
+    virtual bool key(std::string_view) { return true; }
+    virtual bool end_object() { return true; }
+    virtual bool start_array() { return true; }
+    virtual bool end_array() { return true; }
+};
+
+/* JsonDocument
+ *
+ * Immutable alternative to Json for loading data. The whole tree lives in a few large arena
+ * blocks owned by the document instead of one shared_ptr per value: arrays are flat node
+ * arrays, and objects are flat arrays of members sorted by key (looked up by binary search).
+ * Strings are copied into the arena and exposed as string_view.
+ *
+ * JsonElement is a lightweight handle into a document and is only valid while the document
+ * is alive. Missing items and type mismatches give a null element, as Json does.
+ */
+struct JsonNode;
+struct JsonMember;
+struct JsonDocumentBuilder;
+
+class JsonElement final {
+public:
+    JsonElement() noexcept : m_node(nullptr) {}
+
+    Json::Type type() const;
+
+    bool is_null()   const { return type() == Json::NUL; }
+    bool is_number() const { return type() == Json::DOUBLE; }
+    bool is_int()    const { return type() == Json::INT; }
+    bool is_bool()   const { return type() == Json::BOOL; }
+    bool is_string() const { return type() == Json::STRING; }
+    bool is_array()  const { return type() == Json::ARRAY; }
+    bool is_object() const { return type() == Json::OBJECT; }
+
+    double number_value() const;
+    int int_value() const;
+    bool bool_value() const;
+    std::string_view string_value() const;
+
+    // Number of array items or object members, 0 otherwise.
+    size_t size() const;
+    // Array item i, or the value of object member i (members are in key order).
+    JsonElement operator[](size_t i) const;
+    // Value of the object member named key. There is deliberately no const char * overload:
+    // it would make doc.root()[0] ambiguous, and string literals already convert to string_view.
+    JsonElement operator[](std::string_view key) const;
+    // Key of object member i.
+    std::string_view key(size_t i) const;
+
+    // Copy into a regular Json.
+    Json to_json() const;
+
+private:
+    friend class JsonDocument;
+    explicit JsonElement(const JsonNode * node) : m_node(node) {}
+    const JsonNode * m_node;
+};
+
+// Internal layout of JsonDocument values.
+struct JsonNode {
+    Json::Type type;
+    uint32_t size;      // string length, or item / member count
+    union {
+        double number;
+        int int_number;
+        bool boolean;
+        const char * chars;
+        const JsonNode * items;
+        const JsonMember * members;
+    };
+};
+
+struct JsonMember {
+    std::string_view key;
+    JsonNode value;
+};
+
+class JsonDocument final {
+public:
+    JsonDocument() noexcept;
+    JsonDocument(JsonDocument &&) noexcept = default;
+    JsonDocument & operator=(JsonDocument &&) noexcept = default;
+    JsonDocument(const JsonDocument &) = delete;
+    JsonDocument & operator=(const JsonDocument &) = delete;
+
+    // Parse. If parse fails, return an empty document (null root) and assign the same
+    // error message to err as Json::parse would.
+    static JsonDocument parse(const std::string & in,
+                              std::string & err,
+                              JsonParse strategy = JsonParse::STANDARD,
+                              JsonBackend backend = JsonBackend::SCALAR);
+
+    JsonElement root() const { return JsonElement(&m_root); }
+
+    // Bytes reserved by the arena.
+    size_t memory_usage() const { return m_reserved; }
+
+private:
+    friend struct JsonDocumentBuilder;
+    void * allocate(size_t size, size_t align);
+
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    char * m_head;
+    size_t m_remain;
+    size_t m_reserved;
+    size_t m_next_block = 4096;
+    JsonNode m_root;
+};
+
 } // namespace json11
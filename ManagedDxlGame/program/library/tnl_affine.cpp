@@ -0,0 +1,108 @@
+#include "tnl_affine.h"
+#include "tnl_matrix.h"
+#include "tnl_quaternion.h"
+
+namespace tnl {
+
+	Affine::Affine(const Matrix& m) noexcept {
+		for (int j = 0; j < 3; ++j) {
+			c[j][0] = m.m[0][j];
+			c[j][1] = m.m[1][j];
+			c[j][2] = m.m[2][j];
+			c[j][3] = m.m[3][j];
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	// 4 ڂ ( 0, 0, 0, 1 ) ł鎖𗘗p 3 񕪂̐Ϙâ݂ŌvZ
+	Affine Affine::operator * (const Affine& other) const noexcept {
+		simd::vec4 a0 = simd::Load4(c[0]);
+		simd::vec4 a1 = simd::Load4(c[1]);
+		simd::vec4 a2 = simd::Load4(c[2]);
+		Affine out;
+		for (int j = 0; j < 3; ++j) {
+			const float* b = other.c[j];
+			simd::vec4 r = simd::Set(0, 0, 0, b[3]);
+			r = simd::MulAdd(a2, simd::Splat(b[2]), r);
+			r = simd::MulAdd(a1, simd::Splat(b[1]), r);
+			r = simd::MulAdd(a0, simd::Splat(b[0]), r);
+			simd::Store4(out.c[j], r);
+		}
+		return out;
+	}
+
+	Affine& Affine::operator *= (const Affine& other) noexcept {
+		*this = *this * other;
+		return *this;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	Matrix Affine::getMatrix() const noexcept {
+		return static_cast<Matrix>(Float4x4(
+			c[0][0], c[1][0], c[2][0], 0,
+			c[0][1], c[1][1], c[2][1], 0,
+			c[0][2], c[1][2], c[2][2], 0,
+			c[0][3], c[1][3], c[2][3], 1));
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	Affine Affine::Create(const Vector3& pos, const Quaternion& rot, const Vector3& scl) noexcept {
+		float xx = rot.x * rot.x, yy = rot.y * rot.y, zz = rot.z * rot.z;
+		float xy = rot.x * rot.y, xz = rot.x * rot.z, yz = rot.y * rot.z;
+		float wx = rot.w * rot.x, wy = rot.w * rot.y, wz = rot.w * rot.z;
+
+		// ]s̊esɃXP[| 4 sڂWƂs̗i[
+		Affine out;
+		out.c[0][0] = scl.x * (1.0f - 2.0f * (yy + zz));
+		out.c[0][1] = scl.y * (2.0f * (xy - wz));
+		out.c[0][2] = scl.z * (2.0f * (xz + wy));
+		out.c[0][3] = pos.x;
+
+		out.c[1][0] = scl.x * (2.0f * (xy + wz));
+		out.c[1][1] = scl.y * (1.0f - 2.0f * (xx + zz));
+		out.c[1][2] = scl.z * (2.0f * (yz - wx));
+		out.c[1][3] = pos.y;
+
+		out.c[2][0] = scl.x * (2.0f * (xz - wy));
+		out.c[2][1] = scl.y * (2.0f * (yz + wx));
+		out.c[2][2] = scl.z * (1.0f - 2.0f * (xx + yy));
+		out.c[2][3] = pos.z;
+		return out;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	// 3x3 sxNg r0 r1 r2 ƂƋts̊e ( r1 x r2, r2 x r0, r0 x r1 ) / det
+	Affine Affine::Inverse(const Affine& a) noexcept {
+		simd::mat4 rows = simd::Transpose({ {
+			simd::Load4(a.c[0]), simd::Load4(a.c[1]), simd::Load4(a.c[2]), simd::Zero()
+		} });
+		simd::vec4 r0 = rows.r[0], r1 = rows.r[1], r2 = rows.r[2], t = rows.r[3];
+
+		simd::vec4 k[3] = { simd::Cross3(r1, r2), simd::Cross3(r2, r0), simd::Cross3(r0, r1) };
+		simd::vec4 rdet = simd::Splat(1.0f / simd::Dot3(r0, k[0]));
+
+		Affine out;
+		for (int j = 0; j < 3; ++j) {
+			k[j] = simd::Mul(k[j], rdet);
+			simd::Store3(out.c[j], k[j]);
+			out.c[j][3] = -simd::Dot3(t, k[j]);
+		}
+		return out;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	Affine Affine::InverseOrthonormal(const Affine& a) noexcept {
+		simd::mat4 rows = simd::Transpose({ {
+			simd::Load4(a.c[0]), simd::Load4(a.c[1]), simd::Load4(a.c[2]), simd::Zero()
+		} });
+		simd::vec4 t = rows.r[3];
+
+		Affine out;
+		for (int j = 0; j < 3; ++j) {
+			simd::Store3(out.c[j], rows.r[j]);
+			out.c[j][3] = -simd::Dot3(t, rows.r[j]);
+		}
+		return out;
+	}
+
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include "tnl_simd.h"
+#include "tnl_vector.h"
+
+namespace tnl {
+
+	class Matrix;
+	class Quaternion;
+
+	//----------------------------------------------------------------------------------------------
+	// 3x4 AtBϊs
+	// tips... 4x4 s 4  (  0, 0, 0, 1 ) Ȃ 48 byte ̍sł
+	//         IuWFNg̃[hϊ ( XP[E]Esړ ) ̕ێɎgp܂
+	//         s̊|EsxNgK tnl::Matrix Ɠł
+	//         c[ n ]  4x4 s n  ( _1n, _2n, _3n, _4n ) i[Ă܂
+	class Affine final {
+	public:
+		Affine() noexcept :
+			c{
+				{ 1, 0, 0, 0 },
+				{ 0, 1, 0, 0 },
+				{ 0, 0, 1, 0 } }
+		{}
+		explicit Affine(const Matrix& m) noexcept;
+
+		float c[3][4];
+
+		//-----------------------------------------------------------------------------------------------------
+		//
+		// operator
+		//
+		Affine operator * (const Affine& other) const noexcept;
+		Affine& operator *= (const Affine& other) noexcept;
+
+
+		//-----------------------------------------------------------------------------------------------------
+		//
+		// inline function
+		//
+		inline Vector3 getPosition() const noexcept { return { c[0][3], c[1][3], c[2][3] }; }
+
+		// Wϊ
+		inline Vector3 transformCoord(const Vector3& v) const noexcept {
+			simd::vec4 p = simd::Load3Point(v);
+			return {
+				simd::Dot4(simd::Load4(c[0]), p),
+				simd::Dot4(simd::Load4(c[1]), p),
+				simd::Dot4(simd::Load4(c[2]), p) };
+		}
+
+		// xNg̕ϊ ( sړ܂܂Ȃ )
+		inline Vector3 transformNormal(const Vector3& v) const noexcept {
+			simd::vec4 n = simd::Load3(v);
+			return {
+				simd::Dot4(simd::Load4(c[0]), n),
+				simd::Dot4(simd::Load4(c[1]), n),
+				simd::Dot4(simd::Load4(c[2]), n) };
+		}
+
+
+		//-----------------------------------------------------------------------------------------------------
+		//
+		// function
+		//
+
+		//-----------------------------------------------------------------------------------------------------
+		// 4x4 sւ̕ϊ
+		Matrix getMatrix() const noexcept;
+
+
+		//-----------------------------------------------------------------------------------------------------
+		//
+		// static function
+		//
+
+		//-----------------------------------------------------------------------------------------------------
+		// WE]EXP[烏[hϊ쐬
+		// arg1... W
+		// arg2... ]
+		// arg3... XP[
+		// tips... Matrix::Scaling * Quaternion::getMatrix * Matrix::Translation Ɠʂ
+		//         sςȂŋ߂܂
+		static Affine Create(const Vector3& pos, const Quaternion& rot, const Vector3& scl) noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// ts ( XP[܂ވʂ̃AtBϊ )
+		static Affine Inverse(const Affine& a) noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// ts ( ]ƕsړ݂̂̏ꍇ )
+		// tips... 3x3 ]u邾Ȃ̂ Inverse 荂ł
+		static Affine InverseOrthonormal(const Affine& a) noexcept;
+
+	};
+
+	static_assert(sizeof(Affine) == sizeof(float) * 12, "tnl::Affine must be 3x4 floats");
+
+}
@@ -0,0 +1,195 @@
+#include <cmath>
+#include "tnl_broadphase.h"
+#include "tnl_intersect.h"
+
+namespace tnl {
+
+	namespace {
+
+		// ZW 1 ̃rbg ( 3  63 bit )
+		constexpr int32_t CELL_BITS = 21;
+		constexpr int32_t CELL_LIMIT = (1 << (CELL_BITS - 1)) - 1;
+		constexpr uint64_t CELL_MASK = (1ull << CELL_BITS) - 1;
+
+		inline int32_t ToCell(const float v, const float inv_cell_size) noexcept {
+			float c = std::floor(v * inv_cell_size);
+			if (c < static_cast<float>(-CELL_LIMIT)) return -CELL_LIMIT;
+			if (c > static_cast<float>(CELL_LIMIT)) return CELL_LIMIT;
+			return static_cast<int32_t>(c);
+		}
+
+		inline uint64_t ToKey(const int32_t x, const int32_t y, const int32_t z) noexcept {
+			return (static_cast<uint64_t>(x + CELL_LIMIT) << (CELL_BITS * 2))
+				| (static_cast<uint64_t>(y + CELL_LIMIT) << CELL_BITS)
+				| static_cast<uint64_t>(z + CELL_LIMIT);
+		}
+
+		inline int32_t KeyToCell(const uint64_t key, const int shift) noexcept {
+			return static_cast<int32_t>((key >> shift) & CELL_MASK) - CELL_LIMIT;
+		}
+
+		// IsIntersectAABB ƓڂĂ̂͏dȂƂ݂Ȃ
+		inline bool IsOverlap(const Float3& a_min, const Float3& a_max, const Float3& b_min, const Float3& b_max) noexcept {
+			if (a_max.x < b_min.x || a_min.x > b_max.x) return false;
+			if (a_max.y < b_min.y || a_min.y > b_max.y) return false;
+			if (a_max.z < b_min.z || a_min.z > b_max.z) return false;
+			return true;
+		}
+
+		inline BroadphasePair MakePair(const uint32_t a, const uint32_t b) noexcept {
+			return a < b ? BroadphasePair{ a, b } : BroadphasePair{ b, a };
+		}
+
+		void ToMinMax(const Vector3* pos, const Vector3* size, const uint32_t num, std::vector<Float3>& out_min, std::vector<Float3>& out_max) {
+			out_min.resize(num);
+			out_max.resize(num);
+			for (uint32_t i = 0; i < num; ++i) {
+				float hx = size[i].x * 0.5f, hy = size[i].y * 0.5f, hz = size[i].z * 0.5f;
+				out_min[i] = { pos[i].x - hx, pos[i].y - hy, pos[i].z - hz };
+				out_max[i] = { pos[i].x + hx, pos[i].y + hy, pos[i].z + hz };
+			}
+		}
+
+		inline float GetAxis(const Float3& v, const uint32_t axis) noexcept {
+			return (0 == axis) ? v.x : (1 == axis) ? v.y : v.z;
+		}
+	}
+
+
+	//-----------------------------------------------------------------------------------------------------
+	// eIuWFNgdȂZSĂɓo^ăZɃ\[gAZɓ̓m𔻒肷
+	// ̃ZŏdȂyÁA҂̍ŏZ̊e̍őlƂȂZ ( dȂ̈̍ŏZ ) ł̂ݏo͂
+	void BroadphaseGrid::findPairs(const Vector3* pos, const Vector3* size, const uint32_t num, std::vector<BroadphasePair>& out_pairs) {
+		out_pairs.clear();
+		ToMinMax(pos, size, num, min_, max_);
+
+		cell_min_.resize(static_cast<size_t>(num) * 3);
+		is_large_.assign(num, 0);
+		entries_.clear();
+		larges_.clear();
+
+		for (uint32_t i = 0; i < num; ++i) {
+			int32_t x0 = ToCell(min_[i].x, inv_cell_size_), x1 = ToCell(max_[i].x, inv_cell_size_);
+			int32_t y0 = ToCell(min_[i].y, inv_cell_size_), y1 = ToCell(max_[i].y, inv_cell_size_);
+			int32_t z0 = ToCell(min_[i].z, inv_cell_size_), z1 = ToCell(max_[i].z, inv_cell_size_);
+			cell_min_[i * 3 + 0] = x0;
+			cell_min_[i * 3 + 1] = y0;
+			cell_min_[i * 3 + 2] = z0;
+
+			uint64_t cell_num = static_cast<uint64_t>(x1 - x0 + 1) * static_cast<uint64_t>(y1 - y0 + 1) * static_cast<uint64_t>(z1 - z0 + 1);
+			if (cell_num > LARGE_CELL_NUM) {
+				is_large_[i] = 1;
+				larges_.emplace_back(i);
+				continue;
+			}
+			for (int32_t x = x0; x <= x1; ++x) {
+				for (int32_t y = y0; y <= y1; ++y) {
+					for (int32_t z = z0; z <= z1; ++z) {
+						entries_.push_back({ ToKey(x, y, z), i });
+					}
+				}
+			}
+		}
+
+		std::sort(entries_.begin(), entries_.end(), [](const Entry& a, const Entry& b) {
+			return a.key_ < b.key_;
+		});
+
+		size_t n = entries_.size();
+		size_t head = 0;
+		while (head < n) {
+			uint64_t key = entries_[head].key_;
+			size_t tail = head + 1;
+			while (tail < n && entries_[tail].key_ == key) ++tail;
+
+			if (tail - head > 1) {
+				int32_t cx = KeyToCell(key, CELL_BITS * 2);
+				int32_t cy = KeyToCell(key, CELL_BITS);
+				int32_t cz = KeyToCell(key, 0);
+				for (size_t i = head; i < tail; ++i) {
+					uint32_t a = entries_[i].id_;
+					const int32_t* ca = &cell_min_[a * 3];
+					for (size_t k = i + 1; k < tail; ++k) {
+						uint32_t b = entries_[k].id_;
+						const int32_t* cb = &cell_min_[b * 3];
+						if (cx != std::max(ca[0], cb[0])) continue;
+						if (cy != std::max(ca[1], cb[1])) continue;
+						if (cz != std::max(ca[2], cb[2])) continue;
+						if (!IsOverlap(min_[a], max_[a], min_[b], max_[b])) continue;
+						out_pairs.emplace_back(MakePair(a, b));
+					}
+				}
+			}
+			head = tail;
+		}
+
+		// 傫ȃIuWFNg͑SIuWFNgƔ ( 傫Ȃ̓m͔ԍ̑傫̂ )
+		for (uint32_t a : larges_) {
+			for (uint32_t b = 0; b < num; ++b) {
+				if (a == b) continue;
+				if (is_large_[b] && b > a) continue;
+				if (!IsOverlap(min_[a], max_[a], min_[b], max_[b])) continue;
+				out_pairs.emplace_back(MakePair(a, b));
+			}
+		}
+	}
+
+
+	//-----------------------------------------------------------------------------------------------------
+	void BroadphaseSweepAndPrune::findPairs(const Vector3* pos, const Vector3* size, const uint32_t num, std::vector<BroadphasePair>& out_pairs) {
+		out_pairs.clear();
+		ToMinMax(pos, size, num, min_, max_);
+
+		// IuWFNg̕ωÕ\[gʂɔf
+		if (order_.size() > num) {
+			auto it = std::remove_if(order_.begin(), order_.end(), [num](const uint32_t id) { return id >= num; });
+			order_.erase(it, order_.end());
+		}
+		for (uint32_t i = static_cast<uint32_t>(order_.size()); i < num; ++i) {
+			order_.emplace_back(i);
+		}
+
+		sort_min_.resize(num);
+		sort_max_.resize(num);
+		for (uint32_t i = 0; i < num; ++i) {
+			sort_min_[i] = GetAxis(min_[order_[i]], axis_);
+		}
+
+		// O̕т̑}\[g ( قڐς݂Ȃ̂ňړ͏Ȃ )
+		for (uint32_t i = 1; i < num; ++i) {
+			float key = sort_min_[i];
+			uint32_t id = order_[i];
+			uint32_t k = i;
+			while (k > 0 && sort_min_[k - 1] > key) {
+				sort_min_[k] = sort_min_[k - 1];
+				order_[k] = order_[k - 1];
+				--k;
+			}
+			sort_min_[k] = key;
+			order_[k] = id;
+		}
+		for (uint32_t i = 0; i < num; ++i) {
+			sort_max_[i] = GetAxis(max_[order_[i]], axis_);
+		}
+
+		// XC[v
+		for (uint32_t i = 0; i < num; ++i) {
+			uint32_t a = order_[i];
+			float a_max = sort_max_[i];
+			for (uint32_t k = i + 1; k < num && sort_min_[k] <= a_max; ++k) {
+				uint32_t b = order_[k];
+				if (!IsOverlap(min_[a], max_[a], min_[b], max_[b])) continue;
+				out_pairs.emplace_back(MakePair(a, b));
+			}
+		}
+	}
+
+
+	//-----------------------------------------------------------------------------------------------------
+	void NarrowphaseSphere(std::vector<BroadphasePair>& pairs, const Vector3* pos, const float* radius) {
+		Narrowphase(pairs, [&](const uint32_t a, const uint32_t b) {
+			return IsIntersectSphere(pos[a], radius[a], pos[b], radius[b]);
+		});
+	}
+
+}
@@ -0,0 +1,133 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "tnl_vector.h"
+
+namespace tnl {
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// u[htF[YՓ˔
+	//
+	// tips... ʂ̃IuWFNgm̏Փ˔ŁA ( O(n^2) ) ̑
+	//         AABB dȂĂ\̂gݍ킹 ( yA ) ɗ񋓂܂
+	//         AABB  tnl::IsIntersectAABB Ɠ SW  TCY Ŏw肵܂
+	//         񋓂ꂽyA AABB mdȂĂ鎖܂ŊmFς݂Ȃ̂
+	//         JvZȂ AABB ȊǑ` Narrowphase  tnl_intersect ̊֐ɓnči荞݂܂
+	//
+	//         yȀo͐͌ĂяoŎ񂵁At[ėp鎖Ńmۂ܂
+	//
+
+	// yA ( a_ < b_ )
+	struct BroadphasePair {
+		uint32_t a_;
+		uint32_t b_;
+	};
+
+
+	//----------------------------------------------------------------------------------------------
+	// lObh ( ԃnbV )
+	// tips... IuWFNg̑傫ZTCYƓxŁA΂ȂꍇɌĂ܂
+	//         ZTCY̓IuWFNg̕ϓIȑ傫xڈł
+	//         Zׂ萔𒴂傫ȃIuWFNg͕ʘgőSIuWFNgƔ肵܂
+	class BroadphaseGrid final {
+	public:
+		explicit BroadphaseGrid(const float cell_size) noexcept : cell_size_(cell_size), inv_cell_size_(1.0f / cell_size) {}
+
+		//-----------------------------------------------------------------------------------------------------
+		// yA̗
+		// arg1... AABB ̒SWz
+		// arg2... AABB ̃TCYz
+		// arg3... IuWFNg
+		// arg4... yȀo͐ ( 擪 clear ܂ )
+		// tips... o͂yȀԂ͕sł
+		void findPairs(const Vector3* pos, const Vector3* size, const uint32_t num, std::vector<BroadphasePair>& out_pairs);
+
+		inline float getCellSize() const noexcept { return cell_size_; }
+		inline void setCellSize(const float cell_size) noexcept { cell_size_ = cell_size; inv_cell_size_ = 1.0f / cell_size; }
+
+	private:
+		// 1 ̃IuWFNgo^łZ̏ ( ͕̂ʘg )
+		static constexpr uint32_t LARGE_CELL_NUM = 64;
+
+		struct Entry {
+			uint64_t	key_;
+			uint32_t	id_;
+		};
+
+		float cell_size_;
+		float inv_cell_size_;
+		std::vector<Float3>		min_;
+		std::vector<Float3>		max_;
+		std::vector<int32_t>	cell_min_;	// 3  1 IuWFNg
+		std::vector<Entry>		entries_;
+		std::vector<uint32_t>	larges_;
+		std::vector<uint8_t>	is_large_;
+	};
+
+
+	//----------------------------------------------------------------------------------------------
+	// XC[v & v[
+	// tips... 1  AABB ̍ŏl̏Ƀ\[gAԂdȂ̂c̎Ŕ肵܂
+	//         \[g͑Ǒʂpő}\[gōXV̂
+	//         t[Ԃ̈ړꍇ͂ق O(n) ōς݂܂
+	//         IuWFNg̑傫ɂ΂ĂZTCY̒vȂ̂_ł
+	//         IuWFNgςꍇ͑𖖔ɒǉA菜܂
+	class BroadphaseSweepAndPrune final {
+	public:
+		//-----------------------------------------------------------------------------------------------------
+		// arg1... \[gɎgp鎲 ( 0 : x  1 : y  2 : z )
+		// tips... IuWFNgłU΂Ă鎲w肷ƌ₪ȂȂ܂
+		explicit BroadphaseSweepAndPrune(const uint32_t axis = 0) noexcept : axis_(axis) {}
+
+		//-----------------------------------------------------------------------------------------------------
+		// yA̗
+		// arg1... AABB ̒SWz
+		// arg2... AABB ̃TCYz
+		// arg3... IuWFNg
+		// arg4... yȀo͐ ( 擪 clear ܂ )
+		// tips... o͂yȀԂ͕sł
+		void findPairs(const Vector3* pos, const Vector3* size, const uint32_t num, std::vector<BroadphasePair>& out_pairs);
+
+		//-----------------------------------------------------------------------------------------------------
+		// \[gԂ̔j ( IuWFNg̕тւɂȂȂ )
+		inline void reset() noexcept { order_.clear(); }
+
+		inline uint32_t getAxis() const noexcept { return axis_; }
+		inline void setAxis(const uint32_t axis) noexcept { axis_ = axis; }
+
+	private:
+		uint32_t axis_;
+		std::vector<uint32_t>	order_;		// Õ\[g ( IuWFNgԍ )
+		std::vector<float>		sort_min_;	// order_ ̏ɕׂ\[g̍ŏl
+		std::vector<float>		sort_max_;	// order_ ̏ɕׂ\[g̍ől
+		std::vector<Float3>		min_;
+		std::vector<Float3>		max_;
+	};
+
+
+	//----------------------------------------------------------------------------------------------
+	// i[tF[Y
+	// arg1... yA ( ɎsyA͎菜܂ )
+	// arg2... yA󂯎Փ˂ĂȂ true Ԃ֐ ( tnl_intersect ̊֐Ăяo܂ )
+	// tips... gp (  )
+	//         tnl::Narrowphase(pairs, [&](uint32_t a, uint32_t b) {
+	//             return tnl::IsIntersectSphere(pos[a], radius[a], pos[b], radius[b]);
+	//         });
+	template<class IS_INTERSECT>
+	inline void Narrowphase(std::vector<BroadphasePair>& pairs, IS_INTERSECT is_intersect) {
+		auto it = std::remove_if(pairs.begin(), pairs.end(), [&](const BroadphasePair& p) {
+			return !is_intersect(p.a_, p.b_);
+		});
+		pairs.erase(it, pairs.end());
+	}
+
+	//----------------------------------------------------------------------------------------------
+	// i[tF[Y (  )
+	// arg1... yA ( ɎsyA͎菜܂ )
+	// arg2... ̒SWz
+	// arg3... ̔az
+	// tips... u[htF[Yɂ a * 2 ẽTCYƂ AABB nĂ
+	void NarrowphaseSphere(std::vector<BroadphasePair>& pairs, const Vector3* pos, const float* radius);
+
+}
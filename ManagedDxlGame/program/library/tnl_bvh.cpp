@@ -0,0 +1,350 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include "tnl_bvh.h"
+
+namespace tnl {
+
+	namespace {
+
+		constexpr uint32_t BVH_LEAF_TRIS_MAX = 4;		// SAH ŕȂꍇ̗t̍őOp`
+		constexpr uint32_t BVH_LEAF_TRIS_LIMIT = 15;	// Node::tris_ Ɋi[łOp`̏
+		constexpr uint32_t BVH_SAH_BIN_NUM = 12;
+		constexpr uint32_t BVH_FILE_VERSION = 2;
+
+		struct Bounds {
+			float min_[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+			float max_[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+			inline void grow(const float p[3]) {
+				for (int i = 0; i < 3; ++i) {
+					min_[i] = std::min(min_[i], p[i]);
+					max_[i] = std::max(max_[i], p[i]);
+				}
+			}
+			inline void grow(const Bounds& b) {
+				for (int i = 0; i < 3; ++i) {
+					min_[i] = std::min(min_[i], b.min_[i]);
+					max_[i] = std::max(max_[i], b.max_[i]);
+				}
+			}
+			inline float area() const {
+				float dx = max_[0] - min_[0], dy = max_[1] - min_[1], dz = max_[2] - min_[2];
+				if (dx < 0 || dy < 0 || dz < 0) return 0;
+				return dx * dy + dy * dz + dz * dx;
+			}
+		};
+
+		struct BuildTriangle {
+			Bounds bounds_;
+			float center_[3];
+		};
+
+		class Builder {
+		public:
+			Builder(const std::vector<BuildTriangle>& tris, std::vector<uint32_t>& order, std::vector<TriangleBVH::Node>& nodes)
+				: tris_(tris), order_(order), nodes_(nodes) {}
+
+			void build(const uint32_t first, const uint32_t count) {
+				uint32_t node_idx = static_cast<uint32_t>(nodes_.size());
+				nodes_.emplace_back();
+
+				Bounds bounds, center_bounds;
+				for (uint32_t i = first; i < first + count; ++i) {
+					const BuildTriangle& t = tris_[order_[i]];
+					bounds.grow(t.bounds_);
+					center_bounds.grow(t.center_);
+				}
+
+				uint32_t split = (count > 1) ? findSplit(first, count, bounds, center_bounds) : 0;
+
+				TriangleBVH::Node& node = nodes_[node_idx];
+				memcpy(node.min_, bounds.min_, sizeof(float) * 3);
+				memcpy(node.max_, bounds.max_, sizeof(float) * 3);
+
+				if (0 == split) {
+					node.tris_ = (first << 4) | count;
+				}
+				else {
+					node.tris_ = 0;
+					build(first, split);
+					build(first + split, count - split);
+				}
+				// [D揇Ȃ̂ŕ؂̒オѐ
+				nodes_[node_idx].escape_ = static_cast<uint32_t>(nodes_.size());
+			}
+
+		private:
+			const std::vector<BuildTriangle>& tris_;
+			std::vector<uint32_t>& order_;
+			std::vector<TriangleBVH::Node>& nodes_;
+
+			// ret.... ̎Op` ( 0 Ȃtɂ )
+			uint32_t findSplit(const uint32_t first, const uint32_t count, const Bounds& bounds, const Bounds& center_bounds) {
+
+				float best_cost = FLT_MAX;
+				int best_axis = -1;
+				uint32_t best_bin = 0;
+
+				for (int axis = 0; axis < 3; ++axis) {
+					float lo = center_bounds.min_[axis];
+					float ext = center_bounds.max_[axis] - lo;
+					if (ext <= 0.0f) continue;
+					float scale = BVH_SAH_BIN_NUM / ext;
+
+					Bounds bin_bounds[BVH_SAH_BIN_NUM];
+					uint32_t bin_count[BVH_SAH_BIN_NUM] = {};
+					for (uint32_t i = first; i < first + count; ++i) {
+						const BuildTriangle& t = tris_[order_[i]];
+						uint32_t b = std::min(BVH_SAH_BIN_NUM - 1, static_cast<uint32_t>((t.center_[axis] - lo) * scale));
+						bin_bounds[b].grow(t.bounds_);
+						++bin_count[b];
+					}
+
+					// EݐςʐςƎOp`
+					float right_area[BVH_SAH_BIN_NUM];
+					uint32_t right_count[BVH_SAH_BIN_NUM];
+					Bounds acc;
+					uint32_t acc_count = 0;
+					for (uint32_t b = BVH_SAH_BIN_NUM - 1; b > 0; --b) {
+						acc.grow(bin_bounds[b]);
+						acc_count += bin_count[b];
+						right_area[b] = acc.area();
+						right_count[b] = acc_count;
+					}
+
+					acc = Bounds();
+					acc_count = 0;
+					for (uint32_t b = 0; b < BVH_SAH_BIN_NUM - 1; ++b) {
+						acc.grow(bin_bounds[b]);
+						acc_count += bin_count[b];
+						if (0 == acc_count || 0 == right_count[b + 1]) continue;
+						float cost = acc.area() * acc_count + right_area[b + 1] * right_count[b + 1];
+						if (cost < best_cost) {
+							best_cost = cost;
+							best_axis = axis;
+							best_bin = b;
+						}
+					}
+				}
+
+				// ȂȂtɂ ( RXgOp` 1 ƂĔr )
+				float leaf_cost = bounds.area() * (count - 1);
+				if (count <= BVH_LEAF_TRIS_MAX && (best_axis < 0 || best_cost >= leaf_cost)) return 0;
+
+				if (best_axis < 0) {
+					// dSSĈvĂꍇ͐Ŕɕ
+					if (count <= BVH_LEAF_TRIS_LIMIT) return 0;
+					return count / 2;
+				}
+
+				float lo = center_bounds.min_[best_axis];
+				float scale = BVH_SAH_BIN_NUM / (center_bounds.max_[best_axis] - lo);
+				auto it = std::partition(order_.begin() + first, order_.begin() + first + count, [&](const uint32_t idx) {
+					uint32_t b = std::min(BVH_SAH_BIN_NUM - 1, static_cast<uint32_t>((tris_[idx].center_[best_axis] - lo) * scale));
+					return b <= best_bin;
+				});
+				return static_cast<uint32_t>(it - (order_.begin() + first));
+			}
+		};
+
+		// tips... 0 ͋ɏlɒu 0 * inf ɂ NaN 
+		inline float SafeInverse(const float d) {
+			const float eps = 1e-20f;
+			if (fabsf(d) < eps) return (d < 0.0f) ? -1.0f / eps : 1.0f / eps;
+			return 1.0f / d;
+		}
+
+		inline bool RayNode(const TriangleBVH::Node& n, const float p[3], const float inv_d[3], const float t_max) {
+			float t0 = 0.0f, t1 = t_max;
+			for (int i = 0; i < 3; ++i) {
+				float a = (n.min_[i] - p[i]) * inv_d[i];
+				float b = (n.max_[i] - p[i]) * inv_d[i];
+				if (a > b) std::swap(a, b);
+				t0 = std::max(t0, a);
+				t1 = std::min(t1, b);
+			}
+			return t0 <= t1;
+		}
+
+		// Moller-Trumbore (  )
+		inline bool RayTriangle(const Float3* v, const Vector3& p, const Vector3& d, float& t) {
+			Vector3 v0(v[0]);
+			Vector3 e1 = Vector3(v[1]) - v0;
+			Vector3 e2 = Vector3(v[2]) - v0;
+			Vector3 h = Vector3::Cross(d, e2);
+			float a = Vector3::Dot(e1, h);
+			if (fabsf(a) < FLT_EPSILON * FLT_EPSILON) return false;
+			float f = 1.0f / a;
+			Vector3 s = p - v0;
+			float u = f * Vector3::Dot(s, h);
+			if (u < 0.0f || u > 1.0f) return false;
+			Vector3 q = Vector3::Cross(s, e1);
+			float w = f * Vector3::Dot(d, q);
+			if (w < 0.0f || u + w > 1.0f) return false;
+			t = f * Vector3::Dot(e2, q);
+			return t >= 0.0f;
+		}
+	}
+
+	//----------------------------------------------------------------------------------------------
+	Shared<TriangleBVH> TriangleBVH::Create(const float* positions, const uint32_t stride, const uint32_t vtx_num, const uint32_t* idxs, const uint32_t idx_num) {
+
+		Shared<TriangleBVH> bvh = Shared<TriangleBVH>(new TriangleBVH());
+		bvh->src_vtx_num_ = vtx_num;
+		bvh->src_hash_ = SourceHash(positions, stride, vtx_num, idxs, idx_num);
+		uint32_t tri_num = idx_num / 3;
+		if (0 == tri_num || 0 == vtx_num) return bvh;
+
+		const char* base = reinterpret_cast<const char*>(positions);
+		auto vtx = [&](const uint32_t i) { return reinterpret_cast<const float*>(base + static_cast<size_t>(stride) * i); };
+
+		std::vector<BuildTriangle> tris(tri_num);
+		for (uint32_t i = 0; i < tri_num; ++i) {
+			BuildTriangle& t = tris[i];
+			for (int k = 0; k < 3; ++k) t.bounds_.grow(vtx(idxs[i * 3 + k]));
+			for (int k = 0; k < 3; ++k) t.center_[k] = (t.bounds_.min_[k] + t.bounds_.max_[k]) * 0.5f;
+		}
+
+		std::vector<uint32_t> order(tri_num);
+		for (uint32_t i = 0; i < tri_num; ++i) order[i] = i;
+
+		bvh->nodes_.reserve(tri_num * 2);
+		Builder(tris, order, bvh->nodes_).build(0, tri_num);
+		bvh->nodes_.shrink_to_fit();
+
+		// t̏ɎOp`בւĊi[
+		bvh->tri_vtxs_.resize(tri_num * 3);
+		bvh->tri_ids_ = std::move(order);
+		for (uint32_t i = 0; i < tri_num; ++i) {
+			for (int k = 0; k < 3; ++k) {
+				const float* p = vtx(idxs[bvh->tri_ids_[i] * 3 + k]);
+				bvh->tri_vtxs_[i * 3 + k] = Float3(p[0], p[1], p[2]);
+			}
+		}
+		return bvh;
+	}
+
+	//----------------------------------------------------------------------------------------------
+	uint64_t TriangleBVH::SourceHash(const float* positions, const uint32_t stride, const uint32_t vtx_num, const uint32_t* idxs, const uint32_t idx_num) {
+		uint64_t hash = 0xcbf29ce484222325ull;
+		auto feed = [&](const void* data, const size_t size) {
+			const uint8_t* b = static_cast<const uint8_t*>(data);
+			for (size_t i = 0; i < size; ++i) {
+				hash ^= b[i];
+				hash *= 0x100000001b3ull;
+			}
+		};
+		// WȊO̒_vf ( @ UV )  BVH ɉeȂ̂Ŋ܂߂Ȃ
+		const char* base = reinterpret_cast<const char*>(positions);
+		for (uint32_t i = 0; i < vtx_num; ++i) feed(base + static_cast<size_t>(stride) * i, sizeof(float) * 3);
+		if (idx_num) feed(idxs, sizeof(uint32_t) * idx_num);
+		return hash;
+	}
+
+	//----------------------------------------------------------------------------------------------
+	bool TriangleBVH::intersect(const Vector3& pos, const Vector3& dir, const float t_max, Vector3* intersect_pos, uint32_t* triangle_index) const noexcept {
+
+		const float p[3] = { pos.x, pos.y, pos.z };
+		const float inv_d[3] = { SafeInverse(dir.x), SafeInverse(dir.y), SafeInverse(dir.z) };
+
+		float t_near = t_max;
+		uint32_t hit = UINT32_MAX;
+		uint32_t node_num = static_cast<uint32_t>(nodes_.size());
+		uint32_t i = 0;
+
+		while (i < node_num) {
+			const Node& n = nodes_[i];
+			if (!RayNode(n, p, inv_d, t_near)) {
+				i = n.escape_;
+				continue;
+			}
+			if (0 == n.tris_) {
+				++i;
+				continue;
+			}
+			uint32_t first = n.tris_ >> 4;
+			uint32_t last = first + (n.tris_ & 0xf);
+			for (uint32_t k = first; k < last; ++k) {
+				float t;
+				if (!RayTriangle(&tri_vtxs_[k * 3], pos, dir, t)) continue;
+				if (t > t_near) continue;
+				t_near = t;
+				hit = k;
+			}
+			i = n.escape_;
+		}
+
+		if (UINT32_MAX == hit) return false;
+		if (intersect_pos) *intersect_pos = pos + (dir * t_near);
+		if (triangle_index) *triangle_index = tri_ids_[hit];
+		return true;
+	}
+
+	//----------------------------------------------------------------------------------------------
+	bool TriangleBVH::isIntersectRay(const Vector3& pos, const Vector3& dir, Vector3* intersect_pos, uint32_t* triangle_index) const noexcept {
+		return intersect(pos, dir, FLT_MAX, intersect_pos, triangle_index);
+	}
+
+	//----------------------------------------------------------------------------------------------
+	bool TriangleBVH::isIntersectLine(const Vector3& s, const Vector3& e, Vector3* intersect_pos, uint32_t* triangle_index) const noexcept {
+		return intersect(s, e - s, 1.0f, intersect_pos, triangle_index);
+	}
+
+	//----------------------------------------------------------------------------------------------
+	/*
+	*  BVH data format
+	* 3  byte : "bvh"
+	* 4  byte : version
+	* 4  byte : node num
+	* 4  byte : triangle num
+	* 4  byte : source vertex num
+	* 8  byte : source hash ( SourceHash )
+	* 32 byte : node ... loop node num
+	* 36 byte : triangle vertex xyz * 3 ... loop triangle num
+	* 4  byte : triangle id ... loop triangle num
+	*/
+	bool TriangleBVH::exportForFile(const std::string& file_path) const {
+		FILE* fp = nullptr;
+		if (fopen_s(&fp, file_path.c_str(), "wb") != 0 || !fp) return false;
+
+		uint32_t header[3] = { BVH_FILE_VERSION, getNodeNum(), getTriangleNum() };
+		fwrite("bvh", 3, 1, fp);
+		fwrite(header, sizeof(header), 1, fp);
+		fwrite(&src_vtx_num_, sizeof(src_vtx_num_), 1, fp);
+		fwrite(&src_hash_, sizeof(src_hash_), 1, fp);
+		if (!nodes_.empty()) fwrite(nodes_.data(), sizeof(Node) * nodes_.size(), 1, fp);
+		if (!tri_vtxs_.empty()) fwrite(tri_vtxs_.data(), sizeof(Float3) * tri_vtxs_.size(), 1, fp);
+		if (!tri_ids_.empty()) fwrite(tri_ids_.data(), sizeof(uint32_t) * tri_ids_.size(), 1, fp);
+		fclose(fp);
+		return true;
+	}
+
+	//----------------------------------------------------------------------------------------------
+	Shared<TriangleBVH> TriangleBVH::CreateFromFile(const std::string& file_path) {
+		FILE* fp = nullptr;
+		if (fopen_s(&fp, file_path.c_str(), "rb") != 0 || !fp) return nullptr;
+
+		char format[3] = {};
+		uint32_t header[3] = {};
+		bool ok = (1 == fread(format, 3, 1, fp)) && (0 == memcmp(format, "bvh", 3));
+		ok = ok && (1 == fread(header, sizeof(header), 1, fp)) && (BVH_FILE_VERSION == header[0]);
+
+		Shared<TriangleBVH> bvh = Shared<TriangleBVH>(new TriangleBVH());
+		ok = ok && (1 == fread(&bvh->src_vtx_num_, sizeof(bvh->src_vtx_num_), 1, fp));
+		ok = ok && (1 == fread(&bvh->src_hash_, sizeof(bvh->src_hash_), 1, fp));
+		if (ok) {
+			bvh->nodes_.resize(header[1]);
+			bvh->tri_vtxs_.resize(static_cast<size_t>(header[2]) * 3);
+			bvh->tri_ids_.resize(header[2]);
+			if (header[1]) ok = ok && (1 == fread(bvh->nodes_.data(), sizeof(Node) * header[1], 1, fp));
+			if (header[2]) {
+				ok = ok && (1 == fread(bvh->tri_vtxs_.data(), sizeof(Float3) * bvh->tri_vtxs_.size(), 1, fp));
+				ok = ok && (1 == fread(bvh->tri_ids_.data(), sizeof(uint32_t) * header[2], 1, fp));
+			}
+		}
+		fclose(fp);
+		return ok ? bvh : nullptr;
+	}
+
+}
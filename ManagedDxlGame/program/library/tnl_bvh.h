@@ -0,0 +1,96 @@
+#pragma once
+#include <vector>
+#include <string>
+#include "tnl_util.h"
+#include "tnl_vector.h"
+
+namespace tnl {
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// Op`bV BVH ( Bounding Volume Hierarchy )
+	//
+	// tips... _ECfbNXz񂩂 SAH ( Surface Area Heuristic ) ō\z܂
+	//         m[h͐[D揇ɕׁA؂XLbvۂ̔ѐ ( escape ) Ă̂
+	//         X^bNg킸ɑ܂
+	//         \zʂ̓t@CɕۑEǂݍ݂ł̂ŁAOɍ\zăbVƈꏏɒuĂ܂
+	//         Wׂ͂č\zɎgp_Ɠ ( ʏ̓bṼ[J ) ł
+	//
+	class TriangleBVH final {
+	public:
+
+		// 32 byte m[h
+		struct Node {
+			float		min_[3];
+			uint32_t	escape_;	// ؂XLbvɎɒׂm[h
+			float		max_[3];
+			uint32_t	tris_;		// [ t : ( 擪Op` << 4 ) | Op` ] [  : 0 ]
+		};
+		static_assert(sizeof(Node) == 32, "TriangleBVH::Node must be 32 bytes");
+
+		//-----------------------------------------------------------------------------------------------------
+		// CƂ̍ŋߐڌ
+		// arg1... CW
+		// arg2... CxNg
+		// arg3... _̎󂯎p ( ȗ )
+		// arg4... Op`ԍ̎󂯎p ( CfbNXz [ n * 3 ] ` [ n * 3 + 2 ] ) ( ȗ )
+		// ret.... [Փ˂Ă : true] [Փ˂ĂȂ : false]
+		// tips... Op`̕\͋ʂ܂
+		bool isIntersectRay(const Vector3& pos, const Vector3& dir, Vector3* intersect_pos = nullptr, uint32_t* triangle_index = nullptr) const noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// Ƃ̍ŋߐڌ
+		// arg1... n_
+		// arg2... I_
+		// arg3... n_ɍł߂_̎󂯎p ( ȗ )
+		// arg4... Op`ԍ̎󂯎p ( ȗ )
+		// ret.... [Փ˂Ă : true] [Փ˂ĂȂ : false]
+		bool isIntersectLine(const Vector3& s, const Vector3& e, Vector3* intersect_pos = nullptr, uint32_t* triangle_index = nullptr) const noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// t@Cւ̕ۑ
+		// arg1... ۑ̃pX
+		// ret.... [ true : ۑ ] [ false : ۑs ]
+		bool exportForFile(const std::string& file_path) const;
+
+		inline uint32_t getNodeNum() const noexcept { return static_cast<uint32_t>(nodes_.size()); }
+		inline uint32_t getTriangleNum() const noexcept { return static_cast<uint32_t>(tri_ids_.size()); }
+		inline const std::vector<Node>& getNodes() const noexcept { return nodes_; }
+		inline uint32_t getSourceVertexNum() const noexcept { return src_vtx_num_; }
+		inline uint64_t getSourceHash() const noexcept { return src_hash_; }
+
+		//-----------------------------------------------------------------------------------------------------
+		// \z
+		// arg1... _Wz̐擪 ( x, y, z ̏ float ł鎖 )
+		// arg2... _ 1 ̃oCg ( WȊO̗vf܂ޒ_\̂̏ꍇ͂̍\̂̃TCY )
+		// arg3... _
+		// arg4... CfbNXz ( 3 ŎOp` 1  )
+		// arg5... CfbNX
+		static Shared<TriangleBVH> Create(const float* positions, const uint32_t stride, const uint32_t vtx_num, const uint32_t* idxs, const uint32_t idx_num);
+
+		//-----------------------------------------------------------------------------------------------------
+		// exportForFile ŕۑt@C琶
+		// arg1... t@CpX
+		// ret.... ǂݍ݂Ɏsꍇ nullptr
+		static Shared<TriangleBVH> CreateFromFile(const std::string& file_path);
+
+		//-----------------------------------------------------------------------------------------------------
+		// \zɎgp_WƃCfbNX̃nbVl ( 64 bit FNV-1a )
+		// arg1 ` arg5... Create Ɠ
+		// tips... CreateFromFile œǂݍ BVH ݂̃bVꂽ
+		//         getSourceVertexNum / getTriangleNum / getSourceHash ƔrĊmFł܂
+		static uint64_t SourceHash(const float* positions, const uint32_t stride, const uint32_t vtx_num, const uint32_t* idxs, const uint32_t idx_num);
+
+	private:
+		TriangleBVH() {}
+
+		std::vector<Node>		nodes_;
+		std::vector<Float3>		tri_vtxs_;	// t̏ɕבւOp`̒_ ( 3  1  )
+		std::vector<uint32_t>	tri_ids_;	// בւ̎Op`̌̔ԍ
+		uint32_t				src_vtx_num_ = 0;
+		uint64_t				src_hash_ = 0;
+
+		bool intersect(const Vector3& pos, const Vector3& dir, const float t_max, Vector3* intersect_pos, uint32_t* triangle_index) const noexcept;
+	};
+
+}
@@ -0,0 +1,450 @@
+#pragma once
+#include <cstdint>
+#include <climits>
+#include <cstddef>
+#include <new>
+#include <vector>
+#include <type_traits>
+#include <utility>
+#include <coroutine>
+
+namespace tnl {
+
+/**************************************************************************************************************
+*
+*  gp@Tv
+*
+
+class Test {
+public :
+	tnl::CoSequence<Test> seq_ = tnl::CoSequence<Test>( this, &Test::seqIdle );
+	tnl::SeqTask seqIdle();
+	tnl::SeqTask seqAttack();
+	float x_ = 0;
+};
+
+tnl::SeqTask Test::seqIdle() {
+	// Z L[܂őҋ@
+	co_await seq_.yieldFrame(-1, [&]() {
+		if (tnl::Input::IsKeyDownTrigger(eKeys::KB_Z)) seq_.breakYield();
+	});
+	seq_.change(&Test::seqAttack);
+}
+
+tnl::SeqTask Test::seqAttack() {
+	// 0.5 bĈړ
+	co_await seq_.yieldTime(0.5f, [&]() { x_ += 100.0f * seq_.getDeltaTime(); });
+	// 30 t[ҋ@
+	co_await seq_.waitFrame(30);
+	seq_.change(&Test::seqIdle);
+}
+
+void gameMain(float delta_time) {
+	inst->seq_.update(delta_time);
+}
+
+*****************************************************************************************************/
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// R[`t[̃v[
+	//
+	// tips... V[PX 1 ɂ 1 ێÃV[PXJnR[`̃t[蓖Ă܂
+	//         ꂽt[͗eʂۂ܂܍ėp̂ŁAeԂ 1 xs
+	//         Ԃ̐؂ւœImۂ͔܂
+	//
+	class SeqFramePool final {
+	public:
+		SeqFramePool() {}
+		SeqFramePool(const SeqFramePool&) = delete;
+		SeqFramePool& operator=(const SeqFramePool&) = delete;
+		~SeqFramePool() {
+			for (Header* block : free_) ::operator delete(block);
+		}
+
+		//-----------------------------------------------------------------------------------------------------
+		// R[`t[̊mہE ( SeqTask  promise Ă΂܂ )
+		// tips... Scope Ńv[ݒ肳ĂȂꍇ͒ʏ new Ŋmۂ܂
+		static void* Allocate(const size_t size) {
+			SeqFramePool* pool = current_;
+			Header* block = nullptr;
+			if (pool) block = pool->acquire(size);
+			else {
+				block = static_cast<Header*>(::operator new(sizeof(Header) + size));
+				block->capacity_ = size;
+			}
+			block->pool_ = pool;
+			return block + 1;
+		}
+		static void Deallocate(void* p) noexcept {
+			Header* block = static_cast<Header*>(p) - 1;
+			if (block->pool_) block->pool_->free_.emplace_back(block);
+			else ::operator delete(block);
+		}
+
+		//-----------------------------------------------------------------------------------------------------
+		// R[`Ɋ蓖ĐƂȂv[̐ݒ
+		// tips... CoSequence R[`JnԂݒ肵܂
+		class Scope final {
+		public:
+			explicit Scope(SeqFramePool* pool) noexcept : prev_(current_) { current_ = pool; }
+			~Scope() { current_ = prev_; }
+		private:
+			SeqFramePool* prev_;
+		};
+
+	private:
+		struct alignas(16) Header {
+			SeqFramePool*	pool_;
+			size_t			capacity_;
+		};
+
+		std::vector<Header*> free_;
+		static inline thread_local SeqFramePool* current_ = nullptr;
+
+		Header* acquire(const size_t size) {
+			// ܂钆ōŏ̋󂫃t[
+			size_t best = free_.size();
+			for (size_t i = 0; i < free_.size(); ++i) {
+				if (free_[i]->capacity_ < size) continue;
+				if (best == free_.size() || free_[i]->capacity_ < free_[best]->capacity_) best = i;
+			}
+			if (best != free_.size()) {
+				Header* block = free_[best];
+				free_[best] = free_.back();
+				free_.pop_back();
+				return block;
+			}
+			size_t capacity = (size + 63) & ~static_cast<size_t>(63);
+			Header* block = static_cast<Header*>(::operator new(sizeof(Header) + capacity));
+			block->capacity_ = capacity;
+			return block;
+		}
+	};
+
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// CoSequence ̏ԂƂĎsR[`̖߂l^
+	//
+	class SeqTask final {
+	public:
+		struct promise_type {
+			SeqTask get_return_object() noexcept { return SeqTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			std::suspend_always final_suspend() noexcept { return {}; }
+			void return_void() noexcept {}
+			void unhandled_exception() { throw; }
+
+			static void* operator new(const size_t size) { return SeqFramePool::Allocate(size); }
+			static void operator delete(void* p) noexcept { SeqFramePool::Deallocate(p); }
+		};
+
+		SeqTask() noexcept {}
+		SeqTask(SeqTask&& other) noexcept : handle_(other.handle_) { other.handle_ = nullptr; }
+		SeqTask& operator=(SeqTask&& other) noexcept {
+			if (this == &other) return *this;
+			reset();
+			handle_ = other.handle_;
+			other.handle_ = nullptr;
+			return *this;
+		}
+		SeqTask(const SeqTask&) = delete;
+		SeqTask& operator=(const SeqTask&) = delete;
+		~SeqTask() { reset(); }
+
+		inline bool isValid() const noexcept { return static_cast<bool>(handle_); }
+		inline bool isDone() const noexcept { return !handle_ || handle_.done(); }
+		inline void resume() { if (handle_ && !handle_.done()) handle_.resume(); }
+		inline void reset() noexcept {
+			if (handle_) handle_.destroy();
+			handle_ = nullptr;
+		}
+
+	private:
+		explicit SeqTask(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+		std::coroutine_handle<promise_type> handle_ = nullptr;
+	};
+
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// C++20 R[`ɂV[PX
+	//
+	// T [ ܃NX ]
+	// HISTORY_SIZE [ undo Ŗ߂闚̐ ]
+	// tips... tnl::Sequence ̋^R[` ( TNL_SEQ_CO_*_YIELD_RETURN ) Ɠis co_await ŋLq܂
+	//         ^R[`͖t[Ԋ֐̐擪s yield ̐𐔂܂
+	//         ͒fʒuĊĴ yield ̐Ɋ֌WȂ 1 t[͈̏ł
+	//
+	//         update ł yield IĂ΃R[` co_await ܂ōĊJAyield  1 t[i߂܂
+	//         ^R[`ƓlɁAyield ̊Ԃ̏͑O yield Ĩt[Ɏs܂
+	//         Ԃ̃R[`Ō܂ŎsƁAchange ܂ŉ܂
+	//
+	// tips... R[`t[̓V[PXƂ̃v[犄蓖Ă̂
+	//         eԂ 1 xs͓Imۂ͔܂
+	// tips... ܃NX̃oƂďARs[E[u͂ł܂
+	//
+	template <class T, uint32_t HISTORY_SIZE = 16>
+	class CoSequence final {
+	public:
+		static_assert(HISTORY_SIZE > 0, "HISTORY_SIZE must be greater than 0");
+		using func_type = SeqTask (T::*)();
+
+		//===================================================================================
+		// RXgN^
+		// arg1... ܃NX this |C^w
+		// arg2... ŏɎs܃NX̃o\bh ( SeqTask ԂR[` )
+		//===================================================================================
+		CoSequence(T* obj, func_type func)
+			: object_(obj)
+			, p_now_(func)
+			, p_next_(func)
+			, is_change_(true)
+		{}
+		CoSequence(const CoSequence&) = delete;
+		CoSequence& operator=(const CoSequence&) = delete;
+		~CoSequence() { task_.reset(); }
+
+		//===================================================================================
+		// V[PX̃Abvf[g ( t[ĂяoOK )
+		// arg1... t[Ԃ̌oߎ( b̃f^^C )
+		// ret.... [ true : Ԃ̎s ] [ false : Ԃ̃R[`IĂ ]
+		//===================================================================================
+		bool update(const float delta_time) {
+			delta_time_ = delta_time;
+			if (is_change_) {
+				p_now_ = p_next_;
+				is_change_ = false;
+				start();
+			}
+			sum_time_ += delta_time;
+
+			is_running_ = true;
+			if (!is_yield_) task_.resume();
+			if (is_yield_ && !is_immediately_change_) {
+				if (stepYield()) is_yield_ = false;
+			}
+			is_running_ = false;
+			if (is_immediately_change_) {
+				is_immediately_change_ = false;
+				start();
+			}
+			sum_frame_++;
+			is_start_ = false;
+			return !task_.isDone();
+		}
+
+		//===================================================================================
+		// r
+		//===================================================================================
+		inline bool isComparable(func_type func) const { return p_now_ == func; }
+
+		//===================================================================================
+		// Ԃ̍ŏ̂Pt[ true A
+		//===================================================================================
+		inline bool isStart() const { return is_start_; }
+
+		//===================================================================================
+		// Ԃ̌oߎ ( b ) E o߃t[
+		//===================================================================================
+		inline float getProgressTime() const { return sum_time_; }
+		inline uint32_t getProgressFrame() const { return sum_frame_; }
+
+		//===================================================================================
+		// ݂ update ɓnꂽf^^C ( yield ̃WbNŎgp )
+		//===================================================================================
+		inline float getDeltaTime() const { return delta_time_; }
+
+		//===================================================================================
+		// s yield ̌o߃t[ E oߎ
+		//===================================================================================
+		inline int32_t getYieldFrame() const { return yield_frame_; }
+		inline float getYieldTime() const { return yield_time_; }
+
+		//===================================================================================
+		// Ԃ̕ύX
+		// arg1... ̃t[s܃NX̃\bhw
+		//===================================================================================
+		inline void change(func_type func) {
+			pushHistory(p_now_);
+			p_next_ = func;
+			is_change_ = true;
+		}
+
+		//===================================================================================
+		// 1ȌԂɖ߂
+		// tips... ȌԂ݂ȂΉȂ
+		// tips... k̂͒ HISTORY_SIZE ̕ύX܂
+		//===================================================================================
+		inline void undo() {
+			if (0 == prev_num_) return;
+			prev_head_ = (prev_head_ + HISTORY_SIZE - 1) % HISTORY_SIZE;
+			--prev_num_;
+			p_next_ = p_prevs_[prev_head_];
+			is_change_ = true;
+		}
+
+		//===================================================================================
+		// Ԃ𑦍ɕύX
+		// arg1... s܃NX̃\bhw
+		// tips... t[҂ɏԂύXA update VԂs܂
+		// tips... Ԃ̃R[` yield ̃WbNĂяoꍇ́A炪f_Ő؂ւ܂
+		//===================================================================================
+		inline void immediatelyChange(func_type func) {
+			pushHistory(p_now_);
+			p_now_ = func;
+			is_change_ = false;
+			if (is_running_) {
+				is_immediately_change_ = true;
+				return;
+			}
+			start();
+		}
+
+		//===================================================================================
+		// s yield I
+		// tips... yield ̃WbNĂяoƁÃt[ yield Iđɐi݂܂
+		//===================================================================================
+		inline void breakYield() { is_break_ = true; }
+
+
+		//------------------------------------------------------------------------------------------------------------------------
+		//
+		// co_await Ŏgp yield
+		//
+
+		// tips... Ot̃_nꍇQƂł͂ȂRs[ێ܂ ( Logic ͎QƁEcv CO^ )
+		template <class Logic>
+		class YieldAwaiter {
+			using logic_type = std::remove_cvref_t<Logic>;
+		public:
+			template <class L>
+			YieldAwaiter(CoSequence* seq, const int32_t limit_frame, const float limit_time, L&& logic)
+				: seq_(seq), limit_frame_(limit_frame), limit_time_(limit_time), logic_(std::forward<L>(logic)) {}
+			// 0 t[ E 0 b yield ͒fɂ̂܂ܑɐi
+			bool await_ready() const noexcept { return (limit_time_ < 0) ? (0 == limit_frame_) : (limit_time_ <= 0); }
+			void await_suspend(std::coroutine_handle<>) noexcept {
+				seq_->beginYield(limit_frame_, limit_time_, &logic_, &Call);
+			}
+			void await_resume() const noexcept {}
+		private:
+			CoSequence* seq_;
+			int32_t limit_frame_;
+			float limit_time_;
+			logic_type logic_;
+			static void Call(void* logic) { (*static_cast<logic_type*>(logic))(); }
+		};
+
+		//===================================================================================
+		// t[w yield
+		// arg1... st[ (}CiX̒l breakYield ܂Ōp)
+		// arg2... t[s郆[U`( void() _ )
+		// tips... TNL_SEQ_CO_FRM_YIELD_RETURN Ɠisł
+		//===================================================================================
+		template <class Logic>
+		inline YieldAwaiter<std::remove_cvref_t<Logic>> yieldFrame(const int32_t limit_frame, Logic&& logic) {
+			return YieldAwaiter<std::remove_cvref_t<Logic>>(this, limit_frame, -1.0f, std::forward<Logic>(logic));
+		}
+
+		//===================================================================================
+		// Ԏw yield
+		// arg1... s ( b )
+		// arg2... t[s郆[U`( void() _ )
+		// tips... TNL_SEQ_CO_TIM_YIELD_RETURN Ɠisł
+		//===================================================================================
+		template <class Logic>
+		inline YieldAwaiter<std::remove_cvref_t<Logic>> yieldTime(const float limit_time, Logic&& logic) {
+			return YieldAwaiter<std::remove_cvref_t<Logic>>(this, 0, limit_time, std::forward<Logic>(logic));
+		}
+
+	private:
+		struct Nop { void operator()() const noexcept {} };
+
+	public:
+		//===================================================================================
+		// ɑҋ@ yield
+		// tips... waitFrame(0) E waitTime(0) ͑ҋ@At[̂܂ܑɐi݂܂
+		//===================================================================================
+		inline YieldAwaiter<Nop> waitFrame(const int32_t limit_frame) { return YieldAwaiter<Nop>(this, limit_frame, -1.0f, Nop()); }
+		inline YieldAwaiter<Nop> waitTime(const float limit_time) { return YieldAwaiter<Nop>(this, 0, limit_time, Nop()); }
+
+	private:
+		T* object_;
+		func_type p_now_;
+		func_type p_next_;
+		func_type p_prevs_[HISTORY_SIZE];	// Oobt@
+		uint32_t prev_head_ = 0;
+		uint32_t prev_num_ = 0;
+
+		SeqFramePool pool_;					// task_ ɐ錾 ( ɔj )
+		SeqTask task_;
+
+		float delta_time_ = 0;
+		float sum_time_ = 0;
+		uint32_t sum_frame_ = 0;
+		bool is_start_ = true;
+		bool is_change_ = false;
+		bool is_running_ = false;
+		bool is_immediately_change_ = false;
+
+		// s yield
+		void* yield_logic_ = nullptr;
+		void (*yield_call_)(void*) = nullptr;
+		int32_t yield_limit_frame_ = 0;
+		float yield_limit_time_ = 0;
+		int32_t yield_frame_ = 0;
+		float yield_time_ = 0;
+		bool is_yield_ = false;
+		bool is_break_ = false;
+
+		inline void pushHistory(func_type func) noexcept {
+			p_prevs_[prev_head_] = func;
+			prev_head_ = (prev_head_ + 1) % HISTORY_SIZE;
+			if (prev_num_ < HISTORY_SIZE) ++prev_num_;
+		}
+
+		inline void beginYield(const int32_t limit_frame, const float limit_time, void* logic, void (*call)(void*)) noexcept {
+			yield_logic_ = logic;
+			yield_call_ = call;
+			yield_limit_frame_ = limit_frame;
+			yield_limit_time_ = limit_time;
+			yield_frame_ = 0;
+			yield_time_ = 0;
+			is_yield_ = true;
+			is_break_ = false;
+		}
+
+		// yield  1 t[i߂ ( I true )
+		bool stepYield() {
+			if (yield_limit_time_ >= 0) {
+				if (yield_time_ >= yield_limit_time_) return true;
+				yield_time_ += delta_time_;
+				yield_call_(yield_logic_);
+				yield_frame_++;
+				if (INT32_MAX == yield_frame_) yield_frame_ = 0;
+				return yield_time_ >= yield_limit_time_ || is_break_;
+			}
+			int32_t limit = (0 > yield_limit_frame_) ? INT32_MAX : yield_limit_frame_;
+			if (yield_frame_ >= limit) return true;
+			yield_time_ += delta_time_;
+			yield_call_(yield_logic_);
+			yield_frame_++;
+			if (yield_limit_frame_ < 0 && INT32_MAX == yield_frame_) yield_frame_ = 0;
+			if (yield_limit_frame_ < 0) return is_break_;
+			return yield_frame_ >= limit || is_break_;
+		}
+
+		// Ԃ̃R[`̐ ( ŏ co_await ܂ł͎ update Ŏs )
+		void start() {
+			is_start_ = true;
+			sum_time_ = 0;
+			sum_frame_ = 0;
+			is_yield_ = false;
+			task_.reset();
+			SeqFramePool::Scope scope(&pool_);
+			task_ = (object_->*p_now_)();
+		}
+	};
+
+}
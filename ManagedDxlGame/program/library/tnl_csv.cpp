@@ -0,0 +1,218 @@
+#include <cstring>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "tnl_csv.h"
+
+namespace tnl {
+
+	namespace {
+
+		// "" ň͂܂ꂽZ̕ " T ( ""  " ̃GXP[v )
+		// arg1... J " ̎
+		// ret....  " ̈ʒu ( ĂȂꍇ end )
+		inline const char* FindQuoteEnd(const char* p, const char* const end, bool& is_escaped) {
+			for (;;) {
+				const char* q = static_cast<const char*>(memchr(p, '"', end - p));
+				if (!q) return end;
+				if (q + 1 < end && '"' == q[1]) {
+					is_escaped = true;
+					p = q + 2;
+					continue;
+				}
+				return q;
+			}
+		}
+
+		inline const char* FindOrEnd(const char* p, const char* const end, const char c) {
+			const char* q = static_cast<const char*>(memchr(p, c, end - p));
+			return (q) ? q : end;
+		}
+	}
+
+	//----------------------------------------------------------------------------------------------
+	std::string CsvField::getString() const {
+		if (!is_escaped_) return std::string(view_);
+		std::string s;
+		s.reserve(view_.size());
+		for (size_t i = 0; i < view_.size(); ++i) {
+			s.push_back(view_[i]);
+			if ('"' == view_[i] && i + 1 < view_.size() && '"' == view_[i + 1]) ++i;
+		}
+		return s;
+	}
+
+	//----------------------------------------------------------------------------------------------
+	bool CsvReader::open(const std::string& file_path) {
+		close();
+#if defined(_WIN32)
+		HANDLE file = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (INVALID_HANDLE_VALUE == file) return false;
+		LARGE_INTEGER size = {};
+		if (!GetFileSizeEx(file, &size)) {
+			CloseHandle(file);
+			return false;
+		}
+		file_ = file;
+		size_ = static_cast<size_t>(size.QuadPart);
+
+		// ̃t@C̓}bvłȂ̂ŋ̃f[^ƂĈ
+		if (0 == size_) {
+			data_ = "";
+			return true;
+		}
+		mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping_) view_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+#else
+		const int fd = ::open(file_path.c_str(), O_RDONLY);
+		if (fd < 0) return false;
+		struct stat st = {};
+		if (0 != fstat(fd, &st)) {
+			::close(fd);
+			return false;
+		}
+		file_ = reinterpret_cast<void*>(static_cast<intptr_t>(fd) + 1);
+		size_ = static_cast<size_t>(st.st_size);
+		if (0 == size_) {
+			data_ = "";
+			return true;
+		}
+		void* view = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (MAP_FAILED != view) view_ = view;
+#endif
+		if (!view_) {
+			close();
+			return false;
+		}
+		data_ = static_cast<const char*>(view_);
+		rewind();
+		return true;
+	}
+
+	//----------------------------------------------------------------------------------------------
+	void CsvReader::openMemory(const char* data, const size_t size) {
+		close();
+		data_ = (data) ? data : "";
+		size_ = (data) ? size : 0;
+		rewind();
+	}
+
+	//----------------------------------------------------------------------------------------------
+	void CsvReader::close() {
+#if defined(_WIN32)
+		if (view_) UnmapViewOfFile(view_);
+		if (mapping_) CloseHandle(mapping_);
+		if (file_) CloseHandle(file_);
+#else
+		if (view_) munmap(view_, size_);
+		if (file_) ::close(static_cast<int>(reinterpret_cast<intptr_t>(file_) - 1));
+#endif
+		view_ = nullptr;
+		mapping_ = nullptr;
+		file_ = nullptr;
+		data_ = nullptr;
+		size_ = 0;
+		cursor_ = 0;
+		is_utf8_bom_ = false;
+	}
+
+	//----------------------------------------------------------------------------------------------
+	void CsvReader::rewind() {
+		is_utf8_bom_ = (size_ >= 3 && 0 == memcmp(data_, "\xEF\xBB\xBF", 3));
+		cursor_ = (is_utf8_bom_) ? 3 : 0;
+	}
+
+	//----------------------------------------------------------------------------------------------
+	bool CsvReader::readRow(std::vector<CsvField>& row) {
+		row.clear();
+		if (!data_ || cursor_ >= size_) return false;
+
+		const char* p = data_ + cursor_;
+		const char* const end = data_ + size_;
+
+		// s ( "" ň͂܂ꂽZs܂ޏꍇ͓ǂݐi߂ɒT )
+		const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+		if (!eol) eol = end;
+
+		for (;;) {
+			const char* next = nullptr;
+			if (p < end && '"' == *p) {
+				// "" ň͂܂ꂽZ ( ""  " ̃GXP[v )
+				const char* first = ++p;
+				bool is_escaped = false;
+				p = FindQuoteEnd(p, end, is_escaped);
+				row.emplace_back(std::string_view(first, p - first), is_escaped);
+				if (p < end) ++p;
+
+				// ͎̋̕؂܂Ŗ
+				if (p > eol) {
+					eol = static_cast<const char*>(memchr(p, '\n', end - p));
+					if (!eol) eol = end;
+				}
+				next = static_cast<const char*>(memchr(p, ',', eol - p));
+			}
+			else {
+				next = static_cast<const char*>(memchr(p, ',', eol - p));
+				const char* last = (next) ? next : eol;
+				if (!next && last > p && '\r' == last[-1]) --last;
+				row.emplace_back(std::string_view(p, last - p));
+			}
+
+			if (!next) break;
+			p = next + 1;
+		}
+
+		cursor_ = (eol < end) ? static_cast<size_t>(eol - data_) + 1 : size_;
+		return true;
+	}
+
+	//----------------------------------------------------------------------------------------------
+	std::vector<std::pair<size_t, size_t>> CsvReader::splitChunks(const uint32_t num) const {
+		std::vector<std::pair<size_t, size_t>> chunks;
+		if (!data_ || cursor_ >= size_) return chunks;
+
+		const size_t chunk_num = (num > 0) ? num : 1;
+		const char* const first = data_ + cursor_;
+		const char* const end = data_ + size_;
+		const char* begin = first;
+
+		// readRow Ɠ " ̓Z̐擪 ( s , ̒ ) ɂꍇ݂͂̊JnƂAZ̓r " ͕ƂĈ
+		// ݂͂̊Oł͉s͕Ks̋؂Ȃ̂ŁA" ɒHĈ݂͂̊Oɂ target ȍ~̍ŏ̉sT
+		auto is_cell_start = [&](const char* q) { return q == first || ',' == q[-1] || '\n' == q[-1]; };
+		const char* pos = first;							// ݂͂̊Oł邱Ƃm肵Ăʒu
+		const char* quote = FindOrEnd(first, end, '"');		// pos ȍ~ōŏ "
+		const char* lf = nullptr;								// from ȍ~ōŏ̉s
+
+		for (size_t i = 1; i < chunk_num; ++i) {
+			const char* target = first + (size_ - cursor_) * i / chunk_num;
+			if (target <= begin) continue;
+
+			for (;;) {
+				const char* from = (pos > target - 1) ? pos : target - 1;
+				if (!lf || lf < from) lf = FindOrEnd(from, end, '\n');
+				if (quote >= lf) break;
+				if (!is_cell_start(quote)) {
+					quote = FindOrEnd(quote + 1, end, '"');
+					continue;
+				}
+				bool is_escaped = false;
+				const char* close = FindQuoteEnd(quote + 1, end, is_escaped);
+				pos = (close < end) ? close + 1 : end;
+				quote = FindOrEnd(pos, end, '"');
+			}
+			if (lf >= end) break;
+
+			pos = lf + 1;
+			chunks.emplace_back(begin - data_, pos - data_);
+			begin = pos;
+		}
+		if (begin < end) chunks.emplace_back(begin - data_, size_);
+		return chunks;
+	}
+
+}
@@ -1,26 +1,136 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
+#include <utility>
+#include <charconv>
 
 namespace tnl {
 
-	class CsvCell {
+	//----------------------------------------------------------------------------------------------
+	// Csv ̃Z
+	// tips... ̕QƂ邾ŁAlւ̕ϊ getInt ȂǂĂ񂾎ɍs܂
+	//         QƐ ( CsvReader ̃t@C ) 蒷ێȂł
+	//         "" ň͂܂ꂽZ getView ͈݂͈͂͂Ԃ܂
+	//         ( Z ""  getString ł̂ " ɕϊ܂ )
+	class CsvField {
 	public:
-		CsvCell(const std::string& s) {
-			str_ = s;
-			int_ = std::atoi(s.c_str());
-			float_ = (float)std::atof(s.c_str());
-			bool_ = (s == "TRUE") ? true : false;
+		CsvField() = default;
+		CsvField(const std::string_view& view, const bool is_escaped = false) : view_(view), is_escaped_(is_escaped) {}
+
+		inline std::string_view getView() const { return view_; }
+		inline bool isEmpty() const { return view_.empty(); }
+
+		std::string getString() const;
+		inline int getInt() const { return getNumber<int>(); }
+		inline float getFloat() const { return getNumber<float>(); }
+		inline double getDouble() const { return getNumber<double>(); }
+		inline bool getBool() const { return view_ == "TRUE"; }
+
+		// Cӂ̐l^Ŏ擾 ( atoi / atof Ɠlɐ擪̋󔒂 + ͓ǂݔ΂AϊłȂꍇ 0 )
+		template< class T >
+		T getNumber() const {
+			std::string_view v = view_;
+			while (!v.empty() && (' ' == v.front() || '\t' == v.front())) v.remove_prefix(1);
+			if (!v.empty() && '+' == v.front()) v.remove_prefix(1);
+			T value = 0;
+			std::from_chars(v.data(), v.data() + v.size(), value);
+			return value;
 		}
+
+	private:
+		std::string_view view_;
+		bool is_escaped_ = false;	// Z "" ܂
+	};
+
+	//----------------------------------------------------------------------------------------------
+	// }bvɂ Csv [_[
+	// tips... t@CŜɃ}bvAsƂ CsvField ( string_view ) Ƃēǂݏo܂
+	//         s̒ɐ͂܂
+	//         "" ň͂܂ꂽZ ( , s "" ܂ރZ ) ɑΉĂ܂
+	//         ؂蕶 ( , " s )  UTF-8 / Shift-JIS ̕ 2 oCgڈȍ~ɌȂ̂ŁA
+	//         {܂ރt@Ĉ܂ܓǂ߂܂
+	//         UTF-8 ̃t@C DxLib ŕ\ꍇ tnl::UTF8toSjis ŕϊĂ ( BOM ͓ǂݔ΂܂ )
+	//
+	// gp
+	//	tnl::CsvReader csv("data.csv");
+	//	std::vector<tnl::CsvField> row;
+	//	while (csv.readRow(row)) {
+	//		int hp = row[0].getInt();
+	//		std::string name = tnl::UTF8toSjis(row[1].getString());
+	//	}
+	class CsvReader {
+	public:
+		CsvReader() = default;
+		explicit CsvReader(const std::string& file_path) { open(file_path); }
+		~CsvReader() { close(); }
+		CsvReader(const CsvReader&) = delete;
+		CsvReader& operator=(const CsvReader&) = delete;
+
+		//===================================================================================
+		// t@CJ
+		// arg1... t@CpX
+		// ret.... [ true :  ] [ false : s ]
+		//===================================================================================
+		bool open(const std::string& file_path);
+
+		//===================================================================================
+		//  Csv ǂ ( data ͓ǂݏI܂ŕێĂ )
+		//===================================================================================
+		void openMemory(const char* data, const size_t size);
+
+		void close();
+
+		//===================================================================================
+		// ̍sǂݏo
+		// arg1... Z̊i[ ( O̓e͔j܂ )
+		// ret.... [ true : ǂݏo ] [ false : t@C̏I[ ]
+		// tips... s͋̃Z 1 ̍sɂȂ܂
+		//===================================================================================
+		bool readRow(std::vector<CsvField>& row);
+
+		// 擪̍sɖ߂
+		void rewind();
+
+		//===================================================================================
+		// ǂ̕s̋ڂŕ
+		// arg1... 
+		// ret.... e͈͂ [ 擪, I[ ) ( getData ̃oCgʒu )
+		// tips... "" ň͂܂ꂽZ̉sł͕܂
+		//         ݂͂̔ readRow ƓAZ̐擪 " ݂͂ƂĈ܂
+		//         ͈͂ openMemory ŕʂ CsvReader ɓǂ߂܂
+		//===================================================================================
+		std::vector<std::pair<size_t, size_t>> splitChunks(const uint32_t num) const;
+
+		inline bool isOpen() const { return nullptr != data_; }
+		inline const char* getData() const { return data_; }
+		inline size_t getSize() const { return size_; }
+		inline bool isUtf8Bom() const { return is_utf8_bom_; }
+
+	private:
+		const char* data_ = nullptr;
+		size_t size_ = 0;
+		size_t cursor_ = 0;
+		bool is_utf8_bom_ = false;
+
+		// }bv ( openMemory ̏ꍇ null )
+		void* file_ = nullptr;
+		void* mapping_ = nullptr;
+		void* view_ = nullptr;
+	};
+
+	//----------------------------------------------------------------------------------------------
+	// ŕێ Csv ̃Z ( ϊ͎擾ɍs܂ )
+	class CsvCell {
+	public:
+		CsvCell(const std::string& s) : str_(s) {}
+		CsvCell(const CsvField& field) : str_(field.getString()) {}
 		std::string& getString() { return str_; }
-		int getInt() { return int_; }
-		float getFloat() { return float_; }
-		bool getBool() { return bool_; }
+		int getInt() { return CsvField(str_).getInt(); }
+		float getFloat() { return CsvField(str_).getFloat(); }
+		bool getBool() { return str_ == "TRUE"; }
 	private:
 		std::string str_ = "";
-		int int_ = 0;
-		float float_ = 0;
-		bool bool_ = false;
 	};
 
 	template<typename T>
@@ -56,50 +166,35 @@ namespace tnl {
 	// ....... std::string
 	// ....... tnl::CsvCell
 	// ....... ev[gwȗꍇ tnl::CsvCell ɂȂ܂
+	// ....... 傫ȃt@C CsvReader ōsƂɓǂޕRs[Ȃς݂܂
 	template< class T = CsvCell >
 	std::vector<std::vector<T>> LoadCsv(const std::string& file_path){
 		std::vector<std::vector<T>> ret;
 
-		FILE* fp = nullptr;
-		fopen_s(&fp, file_path.c_str(), "r");
-
-		if (fp) {
-			char buff[1024] = { 0 };
-			while (fgets(buff, sizeof(buff), fp)) {
-				std::string line = buff;
-				std::vector<T> data;
-
-				while (1) {
-					size_t c = line.find(",");
-					if (c == std::string::npos) {
-						c = line.find("\n");
-					}
-					std::string s = line.substr(0, c);
-
-					if constexpr (CsvTraits<int>::Value == CsvTraits<T>::Value) {
-						data.emplace_back( std::atoi(s.c_str()) );
-					}
-					if constexpr (CsvTraits<float>::Value == CsvTraits<T>::Value) {
-						data.emplace_back((float)std::atof(s.c_str()));
-					}
-					if constexpr (CsvTraits<std::string>::Value == CsvTraits<T>::Value) {
-						data.emplace_back(std::move(s));
-					}
-					if constexpr (CsvTraits<CsvCell>::Value == CsvTraits<T>::Value) {
-						data.emplace_back( CsvCell(s) );
-					}
-
-					line = line.substr(c + 1, line.length() - (c + 1));
-					if (line.empty() || line == "/n") break;
+		CsvReader csv;
+		if (!csv.open(file_path)) return ret;
+
+		std::vector<CsvField> row;
+		while (csv.readRow(row)) {
+			std::vector<T> data;
+			data.reserve(row.size());
+			for (const CsvField& field : row) {
+				if constexpr (CsvTraits<int>::Value == CsvTraits<T>::Value) {
+					data.emplace_back(field.getInt());
+				}
+				if constexpr (CsvTraits<float>::Value == CsvTraits<T>::Value) {
+					data.emplace_back(field.getFloat());
+				}
+				if constexpr (CsvTraits<std::string>::Value == CsvTraits<T>::Value) {
+					data.emplace_back(field.getString());
+				}
+				if constexpr (CsvTraits<CsvCell>::Value == CsvTraits<T>::Value) {
+					data.emplace_back(CsvCell(field));
 				}
-				ret.emplace_back(std::move(data));
-				memset(buff, 0, sizeof(buff));
 			}
-
-			fclose(fp);
+			ret.emplace_back(std::move(data));
 		}
 		return ret;
 	}
 
 }
-
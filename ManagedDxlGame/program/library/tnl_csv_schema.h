@@ -0,0 +1,291 @@
+#pragma once
+#include <array>
+#include <exception>
+#include <tuple>
+#include <thread>
+#include <type_traits>
+#include "tnl_csv.h"
+
+namespace tnl {
+
+	/*
+
+//
+//  gp@Tv
+//
+
+// stage.csv
+// id,name,hp,slider_speed,bgm
+// 1,X,100,1.5,sound/BGM/EP1_BattleBGM.mp3
+// 2,,150,1.8,sound/BGM/EP2_BattleBGM.mp3
+
+struct StageData {
+	int id = 0;
+	std::string name;
+	int hp = 0;
+	float slider_speed = 0;
+	std::string bgm;
+};
+
+// 񖼂ƃȏΉ ( wb_s̗񖼂őΉt̂ŗ̏Ԃ͎R )
+constexpr tnl::CsvSchema STAGE_SCHEMA{
+	tnl::CsvColumn{ "id", &StageData::id },
+	tnl::CsvColumn{ "name", &StageData::name },
+	tnl::CsvColumn{ "hp", &StageData::hp },
+	tnl::CsvColumn{ "slider_speed", &StageData::slider_speed },
+	tnl::CsvColumn{ "bgm", &StageData::bgm },
+};
+
+void gameStart() {
+	// 1 s 1 vf̘Azɓǂݍ
+	std::vector<StageData> stages = tnl::LoadCsv("stage.csv", STAGE_SCHEMA);
+
+	// 񂲂Ƃ̔zɓǂݍ ( get ̔ԍ̓XL[}̗̏ )
+	auto columns = tnl::LoadCsvColumns("stage.csv", STAGE_SCHEMA);
+	std::vector<int>& hp = std::get<2>(columns);
+}
+
+	*/
+
+	//----------------------------------------------------------------------------------------------
+	// Csv ̗ƍ\̂̃ȏΉ
+	// name_... wb_s̗ ( wb_œǂޏꍇ͎gp܂ )
+	// member_. ǂݍݐ̃o
+	// tips.... ǒ^ l^ / bool / enum / std::string / CsvField \zł^ ( CsvCell Ȃ )
+	template< class Row, class T >
+	struct CsvColumn {
+		const char* name_;
+		T Row::* member_;
+	};
+	template< class Row, class T >
+	CsvColumn(const char*, T Row::*) -> CsvColumn<Row, T>;
+
+	//----------------------------------------------------------------------------------------------
+	// ǂݍݐݒ
+	struct CsvLoadOption {
+		// [ true : 擪s̗񖼂őΉt ] [ false : XL[}̏ = ̏ ]
+		bool is_header_ = true;
+		// ̃TCY ( oCg ) ȏ̃t@C͍s̋ڂŕĕɓǂ
+		size_t parallel_threshold_ = 1024 * 1024;
+		// ɓǂގ̃Xbh ( 0 Ńn[hEFÃXbh )
+		uint32_t thread_num_ = 0;
+	};
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// RpCɗƃȏΉ߂ Csv ̃XL[}
+	//
+	// tips... Z̓o֒ڕϊ̂ŁAsƂ̒Ԕz╶̃Rs[܂
+	//         傫ȃt@C͍s̋ڂŕAXbhƂɓǂł 1 ̔zɂ܂Ƃ߂܂
+	//         s͓ǂݔ΂܂ ܂Asɖƃwb_ɖ̃o͏l̂܂܂ł
+	//
+	template< class Row, class... Ts >
+	class CsvSchema {
+	public:
+		static constexpr size_t COLUMN_NUM = sizeof...(Ts);
+		using Index = std::array<int32_t, COLUMN_NUM>;
+		using Columns = std::tuple<std::vector<Ts>...>;
+
+		constexpr CsvSchema(const CsvColumn<Row, Ts>&... columns) : columns_(columns...) {}
+
+		//===================================================================================
+		// 1 s 1 vf̔zɓǂݍ
+		// arg1... t@CpX
+		// arg2... ǂݍݐݒ
+		// ret.... ǂݍ񂾍s̔z ( t@CJȂꍇ͋ )
+		//===================================================================================
+		std::vector<Row> load(const std::string& file_path, const CsvLoadOption& option = {}) const {
+			CsvReader csv;
+			if (!csv.open(file_path)) return {};
+			const Index index = readIndex(csv, option);
+			const std::vector<std::pair<size_t, size_t>> chunks = csv.splitChunks(getChunkNum(csv, option));
+			if (chunks.empty()) return {};
+
+			std::vector<std::vector<Row>> parts(chunks.size());
+			ForEachChunk(chunks.size(), [&](const size_t n) {
+				CsvReader reader;
+				reader.openMemory(csv.getData() + chunks[n].first, chunks[n].second - chunks[n].first);
+				std::vector<CsvField> fields;
+				while (reader.readRow(fields)) {
+					if (isBlank(fields)) continue;
+					assignRow(parts[n].emplace_back(), fields, index, std::index_sequence_for<Ts...>{});
+				}
+			});
+			if (1 == parts.size()) return std::move(parts[0]);
+
+			// eXbȟʂ 1 ̔zֈړ
+			std::vector<size_t> offsets(parts.size() + 1, 0);
+			for (size_t n = 0; n < parts.size(); ++n) offsets[n + 1] = offsets[n] + parts[n].size();
+			std::vector<Row> rows(offsets.back());
+			ForEachChunk(parts.size(), [&](const size_t n) {
+				std::move(parts[n].begin(), parts[n].end(), rows.begin() + offsets[n]);
+			});
+			return rows;
+		}
+
+		//===================================================================================
+		// 񂲂Ƃ̔zɓǂݍ
+		// arg1... t@CpX
+		// arg2... ǂݍݐݒ
+		// ret.... XL[}̗̏Ԃɕ񂾔z tuple
+		//===================================================================================
+		Columns loadColumns(const std::string& file_path, const CsvLoadOption& option = {}) const {
+			CsvReader csv;
+			if (!csv.open(file_path)) return {};
+			const Index index = readIndex(csv, option);
+			const std::vector<std::pair<size_t, size_t>> chunks = csv.splitChunks(getChunkNum(csv, option));
+			if (chunks.empty()) return {};
+
+			std::vector<Columns> parts(chunks.size());
+			ForEachChunk(chunks.size(), [&](const size_t n) {
+				CsvReader reader;
+				reader.openMemory(csv.getData() + chunks[n].first, chunks[n].second - chunks[n].first);
+				std::vector<CsvField> fields;
+				while (reader.readRow(fields)) {
+					if (isBlank(fields)) continue;
+					assignColumns(parts[n], fields, index, std::index_sequence_for<Ts...>{});
+				}
+			});
+			if (1 == parts.size()) return std::move(parts[0]);
+
+			Columns columns;
+			mergeColumns(columns, parts, std::index_sequence_for<Ts...>{});
+			return columns;
+		}
+
+		// 񖼂擾
+		template< size_t I >
+		constexpr const char* getName() const { return std::get<I>(columns_).name_; }
+
+	private:
+		std::tuple<CsvColumn<Row, Ts>...> columns_;
+
+		template< class T >
+		static void ToValue(const CsvField& field, T& out) {
+			if constexpr (std::is_same_v<T, std::string>) out = field.getString();
+			else if constexpr (std::is_same_v<T, bool>) out = field.getBool();
+			else if constexpr (std::is_enum_v<T>) out = static_cast<T>(field.getNumber<std::underlying_type_t<T>>());
+			else if constexpr (std::is_arithmetic_v<T>) out = field.getNumber<T>();
+			else out = T(field);
+		}
+
+		template< class T >
+		static void ToValue(const std::vector<CsvField>& fields, const int32_t index, T& out) {
+			if (index >= 0 && static_cast<size_t>(index) < fields.size()) ToValue(fields[index], out);
+		}
+
+		static bool isBlank(const std::vector<CsvField>& fields) {
+			return 1 == fields.size() && fields[0].isEmpty();
+		}
+
+		// ɏ ( 擪͌ĂяoXbhŏ )
+		// tips... O̓`NɎ󂯎ASẴXbh join Ăŏ̃`N̗O𓊂
+		//         Xbh쐬łȂ`N͌ĂяoXbhŏ
+		template< class F >
+		static void ForEachChunk(const size_t num, const F& func) {
+			std::vector<std::exception_ptr> errors(num);
+			auto run = [&](const size_t n) {
+				try { func(n); }
+				catch (...) { errors[n] = std::current_exception(); }
+			};
+			std::vector<std::thread> threads;
+			threads.reserve(num);
+			size_t n = 1;
+			try {
+				for (; n < num; ++n) threads.emplace_back(run, n);
+			}
+			catch (...) {
+				for (; n < num; ++n) run(n);
+			}
+			run(0);
+			for (std::thread& t : threads) t.join();
+			for (const std::exception_ptr& e : errors) {
+				if (e) std::rethrow_exception(e);
+			}
+		}
+
+		static uint32_t getChunkNum(const CsvReader& csv, const CsvLoadOption& option) {
+			if (csv.getSize() < option.parallel_threshold_) return 1;
+			uint32_t num = (option.thread_num_ > 0) ? option.thread_num_ : std::thread::hardware_concurrency();
+			return (num > 0) ? num : 1;
+		}
+
+		// e񂪉Ԗڂ̃Z
+		Index readIndex(CsvReader& csv, const CsvLoadOption& option) const {
+			Index index;
+			if (!option.is_header_) {
+				for (size_t i = 0; i < COLUMN_NUM; ++i) index[i] = static_cast<int32_t>(i);
+				return index;
+			}
+			std::vector<CsvField> header;
+			csv.readRow(header);
+			findIndex(index, header, std::index_sequence_for<Ts...>{});
+			return index;
+		}
+
+		template< size_t... I >
+		void findIndex(Index& index, const std::vector<CsvField>& header, std::index_sequence<I...>) const {
+			((index[I] = findColumn(header, std::get<I>(columns_).name_)), ...);
+		}
+
+		static int32_t findColumn(const std::vector<CsvField>& header, const char* name) {
+			for (size_t i = 0; i < header.size(); ++i) {
+				if (header[i].getView() == name) return static_cast<int32_t>(i);
+			}
+			return -1;
+		}
+
+		template< size_t... I >
+		void assignRow(Row& row, const std::vector<CsvField>& fields, const Index& index, std::index_sequence<I...>) const {
+			(ToValue(fields, index[I], row.*(std::get<I>(columns_).member_)), ...);
+		}
+
+		template< size_t... I >
+		static void assignColumns(Columns& columns, const std::vector<CsvField>& fields, const Index& index, std::index_sequence<I...>) {
+			(AppendValue(std::get<I>(columns), fields, index[I]), ...);
+		}
+
+		// vector<bool> ̗vf͎QƂŎ󂯂Ȃ̂ňꎞϐoR
+		template< class T >
+		static void AppendValue(std::vector<T>& column, const std::vector<CsvField>& fields, const int32_t index) {
+			T value{};
+			ToValue(fields, index, value);
+			column.emplace_back(std::move(value));
+		}
+
+		template< size_t... I >
+		static void mergeColumns(Columns& columns, std::vector<Columns>& parts, std::index_sequence<I...>) {
+			std::vector<size_t> offsets(parts.size() + 1, 0);
+			for (size_t n = 0; n < parts.size(); ++n) offsets[n + 1] = offsets[n] + std::get<0>(parts[n]).size();
+			(std::get<I>(columns).resize(offsets.back()), ...);
+			ForEachChunk(parts.size(), [&](const size_t n) {
+				((std::move(std::get<I>(parts[n]).begin(), std::get<I>(parts[n]).end(), std::get<I>(columns).begin() + offsets[n])), ...);
+			});
+		}
+	};
+	template< class Row, class... Ts >
+	CsvSchema(const CsvColumn<Row, Ts>&...) -> CsvSchema<Row, Ts...>;
+
+	//----------------------------------------------------------------------------------------------
+	// XL[}w肵 Csv Loader
+	// arg1... t@CpX
+	// arg2... tnl::CsvSchema
+	// arg3... ǂݍݐݒ
+	// ret.... 1 s 1 vf̔z
+	template< class Row, class... Ts >
+	std::vector<Row> LoadCsv(const std::string& file_path, const CsvSchema<Row, Ts...>& schema, const CsvLoadOption& option = {}) {
+		return schema.load(file_path, option);
+	}
+
+	//----------------------------------------------------------------------------------------------
+	// XL[}w肵 Csv Loader ( 񂲂Ƃ̔z )
+	// arg1... t@CpX
+	// arg2... tnl::CsvSchema
+	// arg3... ǂݍݐݒ
+	// ret.... XL[}̗̏Ԃɕ񂾔z tuple
+	template< class Row, class... Ts >
+	typename CsvSchema<Row, Ts...>::Columns LoadCsvColumns(const std::string& file_path, const CsvSchema<Row, Ts...>& schema, const CsvLoadOption& option = {}) {
+		return schema.loadColumns(file_path, option);
+	}
+
+}
@@ -1,6 +1,10 @@
 #pragma once
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <type_traits>
 #include "tnl_link_linear.h"
 
 
@@ -11,28 +15,135 @@ namespace tnl {
 	// Kwc[\
 	// tips... pĎgp
 	// tips... ̃NXpꍇ shared_ptr łpł܂
+	// tips... enableIndex ōɖO̍ findByName  O(1) ̌ł܂
+	//         ͎q̒ǉE폜EEAsetName ̍ۂɍXV܂
+	//         ؂݂Ԃ́AǉE폜̍ۂɍ܂ł̐eH܂ ( [ɔ )
+	// tips... traverse / flatten / erase Ɣj͍ċAgȂ̂Ő[Kw⑽̎qłgpł܂
 	//
 	TNL_SHARED_FACTORY_CLASS(hierarchy_tree, link_linear)
 	public:
 		using weak = std::weak_ptr< hierarchy_tree >;
 		using shared = std::shared_ptr< hierarchy_tree >;
 
+		//----------------------------------------------------------------------------
+		// flatten ŏo͂vf
+		struct FlatNode {
+			hierarchy_tree*	node_;
+			uint32_t		parent_;	// e̗vfԍ ( 擪vf FLAT_NONE )
+			uint32_t		depth_;		// flatten Ăяom[h̐[
+			uint32_t		end_;		// q̖̗̎vfԍ ( q΂̈ړ )
+		};
+		static constexpr uint32_t FLAT_NONE = 0xffffffff;
+
 	protected:
 		hierarchy_tree() {}
 
 	private:
+		using index_map = std::unordered_multimap<std::string, hierarchy_tree*>;
+
 		weak parent_;
 		shared child_ = nullptr;
+		hierarchy_tree* child_back_ = nullptr;	// q̍Ō ( ǉɌZHȂ )
+		std::string name_;
+		std::unique_ptr<index_map> index_;	// ̂ݕێ
+
+		// ̐ ( 0 ȂǉE폜̍ۂɍ܂ŒHȂ )
+		static inline uint32_t index_num_ = 0;
 		inline shared sharedFromThis() { return std::static_pointer_cast<hierarchy_tree>(shared_from_this()); }
 
+		inline hierarchy_tree* nextPtr() const noexcept { return static_cast<hierarchy_tree*>(getNextPtr()); }
+
+		inline hierarchy_tree* rootPtr() noexcept {
+			hierarchy_tree* node = this;
+			for (shared parent = parent_.lock(); parent; parent = parent->parent_.lock()) node = parent.get();
+			return node;
+		}
+
+		// gƎq̖O֓o^E폜
+		inline void registIndex(index_map& index) {
+			traverse([&](hierarchy_tree* node) {
+				if (!node->name_.empty()) index.emplace(node->name_, node);
+			});
+		}
+		inline void unregistIndex(index_map& index) {
+			traverse([&](hierarchy_tree* node) {
+				if (!node->name_.empty()) node->eraseIndex(index);
+			});
+		}
+		inline void eraseIndex(index_map& index) {
+			auto range = index.equal_range(name_);
+			for (auto it = range.first; it != range.second; ++it) {
+				if (it->second != this) continue;
+				index.erase(it);
+				return;
+			}
+		}
+
+		// ؂ɑgݍ܂ꂽm[h̍֓o^ ( gݍ܂鑤Ă͔j )
+		inline void onLink() {
+			resetIndex();
+			if (0 == index_num_) return;
+			hierarchy_tree* root = rootPtr();
+			if (root->index_) registIndex(*root->index_);
+		}
+		// ؂Om[h̍폜
+		inline void onUnlink() {
+			if (0 == index_num_) return;
+			hierarchy_tree* root = rootPtr();
+			if (root->index_) unregistIndex(*root->index_);
+		}
+
+		inline void resetIndex() noexcept {
+			if (!index_) return;
+			index_.reset();
+			--index_num_;
+		}
+
+		// q̍Ōւ̒ǉ
+		inline void linkChildBack(const shared& add) {
+			if (!child_) {
+				child_ = add;
+				child_back_ = add.get();
+				return;
+			}
+			if (!child_back_ || child_back_->nextPtr()) child_back_ = static_cast<hierarchy_tree*>(child_->getBack().get());
+			child_back_->link_linear::pushBack(add);
+			child_back_ = add.get();
+		}
+
+		// e̎qXgO
+		inline void unlinkFromParent(hierarchy_tree* parent) {
+			if (parent->child_back_ == this) parent->child_back_ = static_cast<hierarchy_tree*>(link_linear::getPrev().get());
+			if (parent->child_.get() == this) parent->child_ = getNext();
+			link_linear::pop();
+		}
+
+		template< class Func >
+		static inline bool Visit(Func& func, hierarchy_tree* node) {
+			if constexpr (std::is_same_v<decltype(func(node)), bool>) return func(node);
+			else { func(node); return true; }
+		}
+
 	public:
-		virtual ~hierarchy_tree() {}
+		virtual ~hierarchy_tree() {
+			resetIndex();
+			// q؂藣ȂAshared_ptr ̉AčċAȂ悤ɂ
+			// ŕێĂm[h͏]ʂqƌ㑱̌Z킲Ǝc
+			std::vector<shared> stack;
+			if (child_) stack.emplace_back(std::move(child_));
+			while (!stack.empty()) {
+				shared node = std::move(stack.back());
+				stack.pop_back();
+				if (node.use_count() > 1) continue;
+				if (node->child_) stack.emplace_back(std::move(node->child_));
+				if (link_linear::shared next = node->link_linear::pop()) stack.emplace_back(std::static_pointer_cast<hierarchy_tree>(next));
+			}
+		}
 
 		//----------------------------------------------------------------------------
 		// ̎擾
 		inline shared getRoot() noexcept {
-			if (!getParent()) return sharedFromThis();
-			return getParent()->getRoot();
+			return rootPtr()->sharedFromThis();
 		}
 
 		//----------------------------------------------------------------------------
@@ -58,47 +169,81 @@ namespace tnl {
 			return getParent()->child_;
 		}
 
+		//----------------------------------------------------------------------------
+		// O̎擾Eݒ
+		// tips... LȖ؂ɑĂꍇ͍XV܂
+		inline const std::string& getName() const noexcept { return name_; }
+		inline void setName(const std::string& name) {
+			hierarchy_tree* root = (0 == index_num_) ? this : rootPtr();
+			if (root->index_ && !name_.empty()) eraseIndex(*root->index_);
+			name_ = name;
+			if (root->index_ && !name_.empty()) root->index_->emplace(name_, this);
+		}
+
+		//----------------------------------------------------------------------------
+		// O̍LE
+		// tips... ̃\bhĂяom[h̍ɍ쐬܂
+		// tips... ؂痣EE폜m[h͍Ȃ̂ŁAKvȂēxLĂ
+		inline void enableIndex() {
+			hierarchy_tree* root = rootPtr();
+			if (root->index_) return;
+			root->index_ = std::make_unique<index_map>();
+			++index_num_;
+			root->registIndex(*root->index_);
+		}
+		inline void disableIndex() noexcept { rootPtr()->resetIndex(); }
+		inline bool isEnableIndex() noexcept { return nullptr != rootPtr()->index_; }
+
 		//----------------------------------------------------------------------------
 		// ̃\bhĂяoCX^XqƂā@q̍Ōɒǉ
 		inline void pushBack(const shared& add) {
-			if (!getParent()) return;
-			shared ptr = find([&](auto node) { return (node == add) ? true : false; });
-			if (ptr == add) return;
+			shared parent = getParent();
+			if (!parent) return;
+			if (add->rootPtr() == rootPtr()) return;
 			add->parent_ = parent_;
-			link_linear::pushBack(add);
+			parent->linkChildBack(add);
+			add->onLink();
 		}
 
 		//----------------------------------------------------------------------------
 		// ̃\bhĂяoCX^XeƂā@q̒ǉ
+		// tips... eȂm[hǉł̂ŁAɖ؂Ɋ܂܂Ă͎̂g̍ǉꍇ݂̂ł
 		virtual inline bool addChild(shared add) {
 			if (add->parent_.lock()) return false;
-			shared ptr = find([&](auto node) { return (node == add) ? true : false; });
-			if (ptr == add) return false ;
+			if (add.get() == this) return false;
+			if (add->child_ && add.get() == rootPtr()) return false;
 			add->parent_ = sharedFromThis();
-			if (child_) {
-				child_->link_linear::pushBack(add);
-				return true;
-			}
-			child_ = add;
+			linkChildBack(add);
+			add->onLink();
 			return true;
 		}
 
 		//--------------------------------------------------------------------------------------
 		// ̃\bhĂяoCX^XqƂā@Ǝ̎qKw\폜
+		// arg1... N_ ( false ͋N_ erase q 1 ɑ΂ČĂяoۂɎw肳Ãm[h܂ )
 		// tips... roundup ֐Ɏw肷郉_֐ł͎gpȂ
+		// tips... q͔zɏW߂ĂqĚZ킪ɂȂ鏇ɉ̂ŁA[KwłċA܂
 		virtual inline void erase( bool is_departure_point = true ) {
-			shared parent = parent_.lock();
-			if (is_departure_point) {
-				if (!parent) return;
+			if (!is_departure_point) {
+				link_linear::pop();
+				parent_.reset();
+				child_.reset();
+				child_back_ = nullptr;
+				return;
 			}
-			if (child_) child_->erase(false);
-			if (!is_departure_point && getNext()) getNext()->erase(false);
-			if (is_departure_point && !getPrev()) {
-				parent->child_ = getNext();
-			}
-			link_linear::pop();
+			shared parent = parent_.lock();
+			if (!parent) return;
+			onUnlink();
+
+			// I܂ŕێĂAŌ 1 
+			std::vector<shared> nodes;
+			traverse([&](hierarchy_tree* node) { nodes.emplace_back(node->sharedFromThis()); }, false);
+			for (auto it = nodes.rbegin(); it != nodes.rend(); ++it) (*it)->erase(false);
+
+			unlinkFromParent(parent.get());
 			parent_.reset();
 			child_.reset();
+			child_back_ = nullptr;
 		}
 
 		//--------------------------------------------------------------------------------------
@@ -107,10 +252,8 @@ namespace tnl {
 		virtual inline void pop() {
 			shared parent = parent_.lock();
 			if (!parent) return;
-			if (parent->getChild() == sharedFromThis()) {
-				parent->child_ = getNext();
-			}
-			link_linear::pop();
+			onUnlink();
+			unlinkFromParent(parent.get());
 			parent_.reset();
 		}
 
@@ -130,12 +273,28 @@ namespace tnl {
 		// arg1... s郉_
 		// arg2... ̊֐Ăяom[hɂ_Kp邩
 		// tips... ̊֐Ɏw肷郉_֐ł pop ֐gpȂ erase ͎gp\
+		// tips... Ăяom[hȍ~̌ZƂ̎qɂKp܂
 		inline void roundup(const std::function<void(shared)>& call, bool is_call = true) {
+			std::vector<shared> stack;
 			shared node = sharedFromThis();
 			if (is_call) call(node);
-			if (node->getChild()) node->getChild()->roundup(call, true);
-			if (node->getNext()) node->getNext()->roundup(call, true);
-			return;
+			while (1) {
+				// q    c̎ ̏ɐi ( iݐ̓_̎sɌ߂ )
+				if (node->child_) {
+					stack.emplace_back(node);
+					node = node->child_;
+				}
+				else {
+					shared next = node->getNext();
+					while (!next && !stack.empty()) {
+						next = stack.back()->getNext();
+						stack.pop_back();
+					}
+					if (!next) return;
+					node = next;
+				}
+				call(node);
+			}
 		}
 
 
@@ -145,20 +304,108 @@ namespace tnl {
 		inline void roundupLinear(const std::function<void(shared)>& call, bool is_call = true) {
 			shared node = sharedFromThis();
 			if (is_call) call(node);
-			if (node->getNext()) node->getNext()->roundupLinear(call, true);
-			return;
+			for (node = node->getNext(); node; node = node->getNext()) call(node);
+		}
+
+
+		//--------------------------------------------------------------------------------------
+		// ̃\bhĂяom[hƎq[D ( s ) ő
+		// arg1... m[h̃|C^󂯎郉_ ( bool Ԃꍇ false őł؂ )
+		// arg2... ̊֐Ăяom[hɂ_Kp邩
+		// ret.... Ō܂ő true
+		// tips... roundup ƈقȂĂяom[ȟZ͑܂
+		// tips... ċAgȂ̂Ő[KwłX^bN܂
+		// tips... ̊֐Ɏw肷郉_֐ł pop ֐ erase ֐ addChild ֐gpȂ
+		template< class Func >
+		bool traverse(Func func, bool is_call = true) {
+			if (is_call && !Visit(func, this)) return false;
+			std::vector<hierarchy_tree*> stack;
+			hierarchy_tree* node = child_.get();
+			while (node) {
+				if (!Visit(func, node)) return false;
+				hierarchy_tree* next = node->nextPtr();
+				if (node->child_) {
+					if (next) stack.emplace_back(next);
+					node = node->child_.get();
+					continue;
+				}
+				if (next) {
+					node = next;
+					continue;
+				}
+				if (stack.empty()) break;
+				node = stack.back();
+				stack.pop_back();
+			}
+			return true;
+		}
+
+
+		//--------------------------------------------------------------------------------------
+		// ̃\bhĂяom[hƎq[D ( s ) ŔzɓWJ
+		// arg1... o͐ ( 擪Ăяom[hA擪 clear ܂ )
+		// tips... t[؂𑖍ꍇ́A\ωWJĔz񂷂ƍł
+		//         out[i] ̎q out[i + 1] ` out[end_ - 1] ɕł܂
+		// tips... z񂪕ێ̂̓|C^Ȃ̂ŁAWJɍ폜m[h͎QƂȂ
+		void flatten(std::vector<FlatNode>& out) {
+			out.clear();
+			std::vector<uint32_t> parents;	// qWJ̗vfԍ
+			out.push_back({ this, FLAT_NONE, 0, 0 });
+			parents.emplace_back(0);
+			hierarchy_tree* node = child_.get();
+			while (node) {
+				uint32_t idx = static_cast<uint32_t>(out.size());
+				out.push_back({ node, parents.back(), static_cast<uint32_t>(parents.size()), idx + 1 });
+				if (node->child_) {
+					parents.emplace_back(idx);
+					node = node->child_.get();
+					continue;
+				}
+				node = node->nextPtr();
+				while (!node && parents.size() > 1) {
+					uint32_t p = parents.back();
+					parents.pop_back();
+					out[p].end_ = static_cast<uint32_t>(out.size());
+					node = out[p].node_->nextPtr();
+				}
+			}
+			out[0].end_ = static_cast<uint32_t>(out.size());
 		}
 
 
 		//----------------------------------------------------------------------------
 		// [U[`̔r֐Ńc[
 		// tips... find ֐Ɏw肷郉_֐ł pop ֐gpȂ
+		// tips... ɍvm[hꍇ͑ōŌ̃m[h
 		shared find(const std::function<bool(shared)>& comp) noexcept {
 			shared out = nullptr;
-			getRoot()->roundup([&](auto node) { if (comp(node)) { out = node; } });
+			rootPtr()->traverse([&](hierarchy_tree* node) {
+				shared s = node->sharedFromThis();
+				if (comp(s)) out = std::move(s);
+			});
 			return out;
 		}
 
+		//----------------------------------------------------------------------------
+		// OŃc[
+		// ret.... Ȃꍇ nullptr
+		// tips... LȂ O(1)AȂSm[h𑖍܂
+		// tips... Õm[hꍇ͂ǂꂪԂ邩͕sł
+		shared findByName(const std::string& name) {
+			hierarchy_tree* root = rootPtr();
+			if (root->index_) {
+				auto it = root->index_->find(name);
+				return (it == root->index_->end()) ? nullptr : it->second->sharedFromThis();
+			}
+			hierarchy_tree* out = nullptr;
+			root->traverse([&](hierarchy_tree* node) {
+				if (node->name_ != name) return true;
+				out = node;
+				return false;
+			});
+			return out ? out->sharedFromThis() : nullptr;
+		}
+
 	};
 
 }
@@ -1,7 +1,61 @@
 #pragma once
+#include <algorithm>
 #include "tnl_instance.h"
 
 namespace tnl {
-	std::unordered_map<std::string, std::function<Shared<Instance>()>>* Instance::generator_register_ = nullptr ;
-	std::unordered_map<std::string, std::function<Shared<Instance>(const std::any&)>>* Instance::generator_desc_register_ = nullptr ;
+
+	bool Instance::is_frozen_ = false;
+
+	namespace {
+		// nbVl̓o^ 1 ɂ܂Ƃ߂ ( ֐͐ɓo^ꂽD )
+		template< class Entry >
+		void MergeEntry(Entry& dst, const Entry& src) {
+			if (!dst.generator_) dst.generator_ = src.generator_;
+			if (!dst.desc_generator_) dst.desc_generator_ = src.desc_generator_;
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Instance::AddEntry(const Entry& entry) {
+		std::vector<Entry>& entries = Register();
+		if (!is_frozen_) {
+			entries.emplace_back(entry);
+			return;
+		}
+		// m̓o^̓\[gۂđ}
+		auto it = std::lower_bound(entries.begin(), entries.end(), entry.hash_, [](const Entry& e, const uint64_t hash) {
+			return e.hash_ < hash;
+		});
+		if (it != entries.end() && it->hash_ == entry.hash_) MergeEntry(*it, entry);
+		else entries.insert(it, entry);
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Instance::FreezeRegister() {
+		if (is_frozen_) return;
+		std::vector<Entry>& entries = Register();
+		std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+			return a.hash_ < b.hash_;
+		});
+		size_t n = 0;
+		for (size_t i = 0; i < entries.size(); ++i) {
+			if (n > 0 && entries[n - 1].hash_ == entries[i].hash_) MergeEntry(entries[n - 1], entries[i]);
+			else entries[n++] = entries[i];
+		}
+		entries.resize(n);
+		entries.shrink_to_fit();
+		is_frozen_ = true;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	const Instance::Entry* Instance::FindEntry(const uint64_t type_hash) {
+		if (!is_frozen_) FreezeRegister();
+		const std::vector<Entry>& entries = Register();
+		auto it = std::lower_bound(entries.begin(), entries.end(), type_hash, [](const Entry& e, const uint64_t hash) {
+			return e.hash_ < hash;
+		});
+		if (it == entries.end() || it->hash_ != type_hash) return nullptr;
+		return &(*it);
+	}
+
 }
@@ -1,53 +1,115 @@
 #pragma once
 
-#include <unordered_map>
-#include <functional>
+#include <vector>
 #include <any>
 #include <string>
+#include <string_view>
 #include "tnl_using.h"
 #include "tnl_shared_factory.h"
 
 namespace tnl {
 
+    //-----------------------------------------------------------------------------------------------------
+    // ^̃nbVl ( 64 bit FNV-1a )
+    // tips... RpCɌvZł̂ Instance::Generate( tnl::TypeHash("ClassName") ) ̂悤Ɏgp܂
+    constexpr uint64_t TypeHash(const std::string_view name) noexcept {
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (const char c : name) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+
+    //-----------------------------------------------------------------------------------------------------
+    //
+    // O̓IɑΉNX
+    //
+    // tips... TNL_INSTANCE_GENERATE_REGISTER œo^^ NX ( }NɓnO ) 
+    //         typeid(type).name() ̃nbVlŐł܂
+    //         o^̓nbVlƊ֐|C^̔zɒǉA̐ ( ܂ FreezeRegister ) 
+    //         \[ĝŁAȍ~͓̐񕪒TƊ֐|C^̌Ăяoōs܂
+    //
     TNL_SHARED_FACTORY_CLASS(Instance, tnl::SharedFactory<Instance>)
     public:
+        using generator = Shared<Instance>(*)();
+        using desc_generator = Shared<Instance>(*)(const std::any&);
+
         template<class T>
         static Shared<T> Generate() { return Instance::Create<T>() ; }
         template<class T>
         static Shared<Instance> GenerateAccompDesc(const std::any& desc) { return Instance::Create<T>(desc); }
+        template<class T>
+        static Shared<Instance> GenerateInstance() { return Instance::Create<T>(); }
 
+        //-----------------------------------------------------------------------------------------------------
+        // o^ꂽ^̐
+        // arg1... TypeHash ŋ߂nbVl ܂ NX
+        // ret.... o^ĂȂꍇ nullptr
+        static Shared<Instance> Generate(const uint64_t type_hash) {
+            const Entry* entry = FindEntry(type_hash);
+            return (entry && entry->generator_) ? entry->generator_() : nullptr;
+        }
         static Shared<Instance> Generate(const std::string& class_name) {
-            auto it = generator_register_->find(class_name);
-            if (it == generator_register_->end()) return nullptr;
-            return it->second();
+            return Generate(TypeHash(class_name));
+        }
+        static Shared<Instance> GenerateAccompDesc(const uint64_t type_hash, const std::any& desc) {
+            const Entry* entry = FindEntry(type_hash);
+            return (entry && entry->desc_generator_) ? entry->desc_generator_(desc) : nullptr;
         }
         static Shared<Instance> GenerateAccompDesc(const std::string& class_name, const std::any& desc) {
-            auto it = generator_desc_register_->find(class_name);
-            if (it == generator_desc_register_->end()) return nullptr;
-            return it->second(desc);
-        }
-        const int static Regist(const std::string& name, const std::function<Shared<Instance>()>& generator) {
-            static std::unordered_map<std::string, std::function<Shared<Instance>()>> generator_register ;
-            generator_register_ = &generator_register;
-            generator_register_->try_emplace(name, generator);
+            return GenerateAccompDesc(TypeHash(class_name), desc);
+        }
+
+        //-----------------------------------------------------------------------------------------------------
+        // ֐̓o^
+        // tips... ʏ TNL_INSTANCE_GENERATE_REGISTER }NgpĂ
+        static int Regist(const uint64_t type_hash, const generator generator) {
+            AddEntry({ type_hash, generator, nullptr });
             return 0;
         }
-        const int static RegistAccompDesc(const std::string& name, const std::function<Shared<Instance>(const std::any& desc)>& generator) {
-            static std::unordered_map<std::string, std::function<Shared<Instance>(const std::any&)>> generator_desc_register;
-            generator_desc_register_ = &generator_desc_register;
-            generator_desc_register_->try_emplace(name, generator);
+        static int Regist(const std::string& name, const generator generator) {
+            return Regist(TypeHash(name), generator);
+        }
+        static int RegistAccompDesc(const uint64_t type_hash, const desc_generator generator) {
+            AddEntry({ type_hash, nullptr, generator });
             return 0;
         }
+        static int RegistAccompDesc(const std::string& name, const desc_generator generator) {
+            return RegistAccompDesc(TypeHash(name), generator);
+        }
+
+        //-----------------------------------------------------------------------------------------------------
+        // o^̊m
+        // tips... o^enbVlŃ\[g܂A Generate łIɌĂ΂܂
+        //         ̃Xbh琶ꍇ́AXbhJnOɌĂяoĂ
+        static void FreezeRegister();
 
     private:
-        static std::unordered_map<std::string, std::function<Shared<Instance>()>>* generator_register_;
-        static std::unordered_map<std::string, std::function<Shared<Instance>(const std::any&)>>* generator_desc_register_;
+        struct Entry {
+            uint64_t        hash_;
+            generator       generator_;
+            desc_generator  desc_generator_;
+        };
+
+        static void AddEntry(const Entry& entry);
+        static const Entry* FindEntry(const uint64_t type_hash);
+
+        // ÓȈɈˑȂ悤֐̐ÓIϐŕێ
+        static std::vector<Entry>& Register() {
+            static std::vector<Entry> entries;
+            return entries;
+        }
+        static bool is_frozen_;
     };
 
 #define TNL_INSTANCE_GENERATE_REGISTER( type )                                                                                          \
-const int gme_temp_regist_##type = tnl::Instance::Regist(typeid(type).name(), tnl::Instance::Generate<type>);                           \
+const int gme_temp_regist_##type = (tnl::Instance::Regist(tnl::TypeHash(#type), tnl::Instance::GenerateInstance<type>),                 \
+                                    tnl::Instance::Regist(typeid(type).name(), tnl::Instance::GenerateInstance<type>));                 \
 
 #define TNL_INSTANCE_ACCOMP_DESC_GENERATE_REGISTER( type )                                                                              \
-const int gme_temp_regist_desc_##type = tnl::Instance::RegistAccompDesc(typeid(type).name(), tnl::Instance::GenerateAccompDesc<type>);  \
-    
+const int gme_temp_regist_desc_##type = (tnl::Instance::RegistAccompDesc(tnl::TypeHash(#type), tnl::Instance::GenerateAccompDesc<type>), \
+                                         tnl::Instance::RegistAccompDesc(typeid(type).name(), tnl::Instance::GenerateAccompDesc<type>)); \
+
 }
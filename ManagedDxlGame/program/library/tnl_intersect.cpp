@@ -1,8 +1,11 @@
 #include <memory>
+#include <cstring>
+#include <cfloat>
 #include "tnl_vector.h"
 #include "tnl_intersect.h"
 #include "tnl_math.h"
 #include "tnl_matrix.h"
+#include "tnl_quaternion.h"
 
 namespace tnl {
 
@@ -59,6 +62,106 @@ namespace tnl {
 		return true;
 	}
 
+	//----------------------------------------------------------------------------------------------
+	//  B ̖ʂɓ鎞Əo鎞߁Ałxi ( SŏdȂn߂鎞 ) ՓˎƂ
+	bool IsIntersectSweptAABB(const tnl::Vector3& a_prev, const tnl::Vector3& a_move, const tnl::Vector3& a_size,
+		const tnl::Vector3& b, const tnl::Vector3& b_size, float* out_time, tnl::Vector3* out_normal)
+	{
+		const float a_min[3] = { a_prev.x - a_size.x * 0.5f, a_prev.y - a_size.y * 0.5f, a_prev.z - a_size.z * 0.5f };
+		const float a_max[3] = { a_prev.x + a_size.x * 0.5f, a_prev.y + a_size.y * 0.5f, a_prev.z + a_size.z * 0.5f };
+		const float b_min[3] = { b.x - b_size.x * 0.5f, b.y - b_size.y * 0.5f, b.z - b_size.z * 0.5f };
+		const float b_max[3] = { b.x + b_size.x * 0.5f, b.y + b_size.y * 0.5f, b.z + b_size.z * 0.5f };
+		const float move[3] = { a_move.x, a_move.y, a_move.z };
+
+		float t_enter = -FLT_MAX;
+		float t_exit = FLT_MAX;
+		int enter_axis = -1;
+		for (int i = 0; i < 3; ++i) {
+			if (0.0f == move[i]) {
+				// Ȃ͐ڂĂ邾ȂdȂƂ݂ȂȂ ( ʂɉړWȂ )
+				if (a_max[i] <= b_min[i] || a_min[i] >= b_max[i]) return false;
+				continue;
+			}
+			float inv = 1.0f / move[i];
+			float t0 = (b_min[i] - a_max[i]) * inv;
+			float t1 = (b_max[i] - a_min[i]) * inv;
+			if (t0 > t1) std::swap(t0, t1);
+			if (t0 > t_enter) {
+				t_enter = t0;
+				enter_axis = i;
+			}
+			if (t1 < t_exit) t_exit = t1;
+			if (t_enter >= t_exit || t_enter > 1.0f || t_exit <= 0.0f) return false;
+		}
+
+		float normal[3] = { 0, 0, 0 };
+		if (enter_axis >= 0 && t_enter >= 0.0f) {
+			normal[enter_axis] = (move[enter_axis] > 0.0f) ? -1.0f : 1.0f;
+		}
+		else {
+			// ړOdȂĂ
+			t_enter = 0.0f;
+			float depth = FLT_MAX;
+			for (int i = 0; i < 3; ++i) {
+				float d_neg = a_max[i] - b_min[i];
+				float d_pos = b_max[i] - a_min[i];
+				if (d_neg < depth) { depth = d_neg; normal[0] = normal[1] = normal[2] = 0; normal[i] = -1.0f; }
+				if (d_pos < depth) { depth = d_pos; normal[0] = normal[1] = normal[2] = 0; normal[i] = 1.0f; }
+			}
+		}
+
+		if (out_time) *out_time = t_enter;
+		if (out_normal) *out_normal = { normal[0], normal[1], normal[2] };
+		return true;
+	}
+
+	//----------------------------------------------------------------------------------------------
+	int GetCorrectPositionSweptAABB(const tnl::Vector3& a_prev, const tnl::Vector3& a_move, const tnl::Vector3& a_size,
+		const tnl::Vector3* b, const tnl::Vector3* b_size, const uint32_t b_num, tnl::Vector3& out, const int max_iteration)
+	{
+		tnl::Vector3 pos = a_prev;
+		tnl::Vector3 move = a_move;
+		int hit_count = 0;
+
+		// ړOdȂĂ B  ł󂭉o鎲̕֏dȂ̐[o
+		int push_count = 0;
+		for (uint32_t i = 0; i < b_num; ++i) {
+			tnl::Vector3 nml;
+			if (!IsIntersectSweptAABB(pos, tnl::Vector3(0, 0, 0), a_size, b[i], b_size[i], nullptr, &nml)) continue;
+			const tnl::Vector3 half = (a_size + b_size[i]) * 0.5f;
+			const tnl::Vector3 dist = b[i] - pos;
+			const float depth = fabsf(nml.x) * (half.x - fabsf(dist.x)) + fabsf(nml.y) * (half.y - fabsf(dist.y)) + fabsf(nml.z) * (half.z - fabsf(dist.z));
+			pos += nml * depth;
+			++push_count;
+		}
+
+		for (int n = 0; n < max_iteration; ++n) {
+			float nearest_t = FLT_MAX;
+			tnl::Vector3 nearest_n;
+			for (uint32_t i = 0; i < b_num; ++i) {
+				float t;
+				tnl::Vector3 nml;
+				if (!IsIntersectSweptAABB(pos, move, a_size, b[i], b_size[i], &t, &nml)) continue;
+				// oֈړĂ鑊 ( Ăr ) ͖
+				if (nml.dot(move) >= 0.0f) continue;
+				if (t < nearest_t) {
+					nearest_t = t;
+					nearest_n = nml;
+				}
+			}
+			if (FLT_MAX == nearest_t) break;
+
+			++hit_count;
+			pos += move * nearest_t;
+			move *= (1.0f - nearest_t);
+			move -= nearest_n * nearest_n.dot(move);
+		}
+
+		// ő񐔂܂ŏՓ˂ꍇ͎c̈ړ̂Ă
+		out = (hit_count < max_iteration) ? pos + move : pos;
+		return push_count + hit_count;
+	}
+
 
 	// `Ƌ`̏Փˌm & W␳
 	int IsIntersectRectToCorrectPosition(tnl::Vector3& a_now, const tnl::Vector3 &a_prev, const int a_rect_size_w, const int a_rect_size_h,
@@ -311,7 +414,7 @@ namespace tnl {
 	bool IsIntersectRayOBB(const Vector3& pos, const Vector3& dir, const Vector3& aabb_max, const Vector3& aabb_min, const Matrix& obb_rot, Vector3& intersect_pos ) {
 
 		// E{bNX̋Ԃֈړ
-		Matrix invMat = Matrix::Inverse(obb_rot);
+		Matrix invMat = Matrix::InverseAffine(obb_rot);
 
 		Vector3 p_l, dir_l;
 		p_l = Vector3::TransformCoord(pos, invMat);
@@ -370,11 +473,8 @@ namespace tnl {
 	}
 
 	//----------------------------------------------------------------------------------------------
-	bool IsIntersectRayTorus(const Vector3& s, const Vector3& dir, const Vector3& tp, const Quaternion& tq, const float tube_r, const float swept_r) {
-
-		tnl::Vector3 o = tnl::Vector3::TransformCoord(s-tp, tq);
-		tnl::Vector3 d = tnl::Vector3::TransformCoord(dir, tq);
-
+	// g[X̃[J ( xz ʂɗ ) ł̃C 4 ̌W
+	static void RayTorusCoeffs(const Vector3& o, const Vector3& d, const float tube_r, const float swept_r, double coeffs[5]) {
 		double ox = o.x;
 		double oy = o.y;
 		double oz = o.z;
@@ -390,63 +490,341 @@ namespace tnl {
 		double f = ox * dx + oy * dy + oz * dz;
 		double four_a_sqrd = 4.0 * swept_r * swept_r;
 
-		std::vector<double> coeffs = {
-			e * e - four_a_sqrd * (tube_r * tube_r - oy * oy),
-				4.0 * f * e + 2.0 * four_a_sqrd * oy * dy,
-				2.0 * sum_d_sqrd * e + 4.0 * f * f + four_a_sqrd * dy * dy,
-				4.0 * sum_d_sqrd * f,
-				sum_d_sqrd * sum_d_sqrd };
+		coeffs[0] = e * e - four_a_sqrd * (tube_r * tube_r - oy * oy);
+		coeffs[1] = 4.0 * f * e + 2.0 * four_a_sqrd * oy * dy;
+		coeffs[2] = 2.0 * sum_d_sqrd * e + 4.0 * f * f + four_a_sqrd * dy * dy;
+		coeffs[3] = 4.0 * sum_d_sqrd * f;
+		coeffs[4] = sum_d_sqrd * sum_d_sqrd;
+	}
 
-		std::vector<double> solution = Solve4(coeffs);
+	// ret.... ̌
+	static int RayTorusSolve(const Vector3& s, const Vector3& dir, const Vector3& tp, const Quaternion& tq, const float tube_r, const float swept_r, double solution[4]) {
+		tnl::Vector3 o = tnl::Vector3::TransformCoord(s - tp, tq);
+		tnl::Vector3 d = tnl::Vector3::TransformCoord(dir, tq);
+		double coeffs[5];
+		RayTorusCoeffs(o, d, tube_r, swept_r, coeffs);
+		return Solve4(coeffs, solution);
+	}
+
+	// ret.... C̑O ( DBL_EPSILON  ) ōł߂ [ OɉȂ : DBL_MAX ]
+	static double RayTorusNearest(const double* solution, const int num) {
+		double mint = DBL_MAX;
+		for (int i = 0; i < num; ++i) {
+			if ((solution[i] > DBL_EPSILON) && (solution[i] < mint)) {
+				mint = solution[i];
+			}
+		}
+		return mint;
+	}
 
+	//----------------------------------------------------------------------------------------------
+	bool IsIntersectRayTorus(const Vector3& s, const Vector3& dir, const Vector3& tp, const Quaternion& tq, const float tube_r, const float swept_r) {
+		double solution[4];
 		// ray misses the torus
-		if (solution.empty()) return false;
+		if (0 == RayTorusSolve(s, dir, tp, tq, tube_r, swept_r, solution)) return false;
 		return true;
 	}
 
 	//----------------------------------------------------------------------------------------------
 	bool IsIntersectRayTorus(const Vector3& s, const Vector3& dir, const Vector3& tp, const Quaternion& tq, const float tube_r, const float swept_r, Vector3& intersect_pos) {
+		double solution[4];
+		int num = RayTorusSolve(s, dir, tp, tq, tube_r, swept_r, solution);
 
-		tnl::Vector3 o = tnl::Vector3::TransformCoord(s - tp, tq);
-		tnl::Vector3 d = tnl::Vector3::TransformCoord(dir, tq);
+		// ray misses the torus
+		if (0 == num) return false;
 
-		double ox = o.x;
-		double oy = o.y;
-		double oz = o.z;
+		double mint = RayTorusNearest(solution, num);
+		intersect_pos = s + dir * (float)mint;
+		return true;
+	}
 
-		double dx = d.x;
-		double dy = d.y;
-		double dz = d.z;
 
-		// define the coefficients of the quartic equation
-		double sum_d_sqrd = dx * dx + dy * dy + dz * dz;
-		double e = ox * ox + oy * oy + oz * oz -
-			swept_r * swept_r - tube_r * tube_r;
-		double f = ox * dx + oy * dy + oz * dz;
-		double four_a_sqrd = 4.0 * swept_r * swept_r;
+	//----------------------------------------------------------------------------------------------
+	void AABBPacket::add(const Vector3& aabb_max, const Vector3& aabb_min) {
+		min_x_.emplace_back(aabb_min.x); min_y_.emplace_back(aabb_min.y); min_z_.emplace_back(aabb_min.z);
+		max_x_.emplace_back(aabb_max.x); max_y_.emplace_back(aabb_max.y); max_z_.emplace_back(aabb_max.z);
+	}
+	void AABBPacket::clear() noexcept {
+		min_x_.clear(); min_y_.clear(); min_z_.clear();
+		max_x_.clear(); max_y_.clear(); max_z_.clear();
+	}
 
-		std::vector<double> coeffs = {
-			e * e - four_a_sqrd * (tube_r * tube_r - oy * oy),
-				4.0 * f * e + 2.0 * four_a_sqrd * oy * dy,
-				2.0 * sum_d_sqrd * e + 4.0 * f * f + four_a_sqrd * dy * dy,
-				4.0 * sum_d_sqrd * f,
-				sum_d_sqrd * sum_d_sqrd };
+	//----------------------------------------------------------------------------------------------
+	void OBBPacket::add(const Vector3& aabb_max, const Vector3& aabb_min, const Matrix& obb_rot) {
+		min_x_.emplace_back(aabb_min.x); min_y_.emplace_back(aabb_min.y); min_z_.emplace_back(aabb_min.z);
+		max_x_.emplace_back(aabb_max.x); max_y_.emplace_back(aabb_max.y); max_z_.emplace_back(aabb_max.z);
+		Matrix inv = Matrix::InverseAffine(obb_rot);
+		for (int r = 0; r < 4; ++r) {
+			for (int c = 0; c < 3; ++c) inv_[r][c].emplace_back(inv.m[r][c]);
+		}
+	}
+	void OBBPacket::clear() noexcept {
+		min_x_.clear(); min_y_.clear(); min_z_.clear();
+		max_x_.clear(); max_y_.clear(); max_z_.clear();
+		for (int r = 0; r < 4; ++r) {
+			for (int c = 0; c < 3; ++c) inv_[r][c].clear();
+		}
+	}
+
+	//----------------------------------------------------------------------------------------------
+	// pPbg 1 {bNX ( IsIntersectRayAABB / IsIntersectRayOBB ̃XuƓ )
+	// tips... AVX2 ̒[ƃXJ[Ŏgp
+	static bool RayBoxSlab(const float p[3], const float d[3], const float min[3], const float max[3], float t_min, const bool is_obb, float& out_t) {
+		float t_max = FLT_MAX;
+		for (int i = 0; i < 3; ++i) {
+			if (fabs(d[i]) < FLT_EPSILON) {
+				if (p[i] < min[i] || p[i] > max[i]) return false;
+			}
+			else {
+				float ood = 1.0f / d[i];
+				float t1 = (min[i] - p[i]) * ood;
+				float t2 = (max[i] - p[i]) * ood;
+				if (t1 > t2) std::swap(t1, t2);
+				if (t1 > t_min) t_min = t1;
+				if (t2 < t_max) t_max = t2;
+				if (is_obb ? (t_min >= t_max) : (t_min > t_max)) return false;
+			}
+		}
+		out_t = t_min;
+		return true;
+	}
 
-		std::vector<double> solution = Solve4(coeffs);
+	// 茋ʃrbg̏ ( 64 vf 1 [h )
+	// AABB / OBB / Torus ̊e Packet ͔OɕKŃ}XNNA
+	static void RayPacketClear(uint64_t* hit_mask, const uint32_t num) {
+		if (hit_mask) memset(hit_mask, 0, sizeof(uint64_t) * ((num + 63) / 64));
+	}
 
-		// ray misses the torus
-		if (solution.empty()) return false;
+	// 茋ʂ̏Wv
+	static void RayPacketRecord(const uint32_t idx, const float t, uint64_t* hit_mask, int& nearest, float& nearest_t) {
+		if (hit_mask) hit_mask[idx >> 6] |= (1ULL << (idx & 63));
+		if (nearest < 0 || t < nearest_t) {
+			nearest = static_cast<int>(idx);
+			nearest_t = t;
+		}
+	}
 
-		double mint = DBL_MAX;
-		for (auto _stage_id : solution) {
-			if ((_stage_id > DBL_EPSILON ) && (_stage_id < mint)) {
-				mint = _stage_id;
+#if defined(TNL_SIMD_AVX2)
+	// 8 [̔茋ʂ̏Wv
+	static void RayPacketRecord8(const uint32_t base, const int lane_mask, const __m256 t, uint64_t* hit_mask, int& nearest, float& nearest_t) {
+		if (!lane_mask) return;
+		alignas(32) float ts[8];
+		_mm256_store_ps(ts, t);
+		for (int k : BitRange64(static_cast<uint32_t>(lane_mask))) {
+			RayPacketRecord(base + k, ts[k], hit_mask, nearest, nearest_t);
+		}
+	}
+#endif
+
+	//----------------------------------------------------------------------------------------------
+	int IsIntersectRayAABBPacket(const Vector3& pos, const Vector3& dir, const AABBPacket& boxes, uint64_t* hit_mask, float* nearest_t) {
+
+		const uint32_t num = boxes.size();
+		RayPacketClear(hit_mask, num);
+
+		const float p[3] = { pos.x, pos.y, pos.z };
+		const float d[3] = { dir.x, dir.y, dir.z };
+		const float* bmin[3] = { boxes.min_x_.data(), boxes.min_y_.data(), boxes.min_z_.data() };
+		const float* bmax[3] = { boxes.max_x_.data(), boxes.max_y_.data(), boxes.max_z_.data() };
+
+		int nearest = -1;
+		float t_near = FLT_MAX;
+		uint32_t n = 0;
+
+#if defined(TNL_SIMD_AVX2)
+		// C͑S{bNXʂȂ̂Ŏ̕s͕ōς
+		bool parallel[3];
+		__m256 vp[3], vood[3];
+		for (int i = 0; i < 3; ++i) {
+			parallel[i] = fabs(d[i]) < FLT_EPSILON;
+			vp[i] = _mm256_set1_ps(p[i]);
+			vood[i] = _mm256_set1_ps(parallel[i] ? 0.0f : 1.0f / d[i]);
+		}
+		for (; n + 8 <= num; n += 8) {
+			__m256 t_min = _mm256_setzero_ps();
+			__m256 t_max = _mm256_set1_ps(FLT_MAX);
+			__m256 valid = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+			for (int i = 0; i < 3; ++i) {
+				__m256 mn = _mm256_loadu_ps(bmin[i] + n);
+				__m256 mx = _mm256_loadu_ps(bmax[i] + n);
+				if (parallel[i]) {
+					valid = _mm256_and_ps(valid, _mm256_and_ps(_mm256_cmp_ps(vp[i], mn, _CMP_GE_OQ), _mm256_cmp_ps(vp[i], mx, _CMP_LE_OQ)));
+					continue;
+				}
+				__m256 t1 = _mm256_mul_ps(_mm256_sub_ps(mn, vp[i]), vood[i]);
+				__m256 t2 = _mm256_mul_ps(_mm256_sub_ps(mx, vp[i]), vood[i]);
+				t_min = _mm256_max_ps(t_min, _mm256_min_ps(t1, t2));
+				t_max = _mm256_min_ps(t_max, _mm256_max_ps(t1, t2));
 			}
+			valid = _mm256_and_ps(valid, _mm256_cmp_ps(t_min, t_max, _CMP_LE_OQ));
+			RayPacketRecord8(n, _mm256_movemask_ps(valid), t_min, hit_mask, nearest, t_near);
+		}
+#endif
+
+		// [ ( XJ[ł͑S{bNX )
+		for (; n < num; ++n) {
+			const float mn[3] = { bmin[0][n], bmin[1][n], bmin[2][n] };
+			const float mx[3] = { bmax[0][n], bmax[1][n], bmax[2][n] };
+			float t;
+			if (RayBoxSlab(p, d, mn, mx, 0.0f, false, t)) RayPacketRecord(n, t, hit_mask, nearest, t_near);
 		}
 
-		intersect_pos = s + dir * (float)mint;
-		return true;
+		if (nearest_t && nearest >= 0) *nearest_t = t_near;
+		return nearest;
+	}
+
+	//----------------------------------------------------------------------------------------------
+	int IsIntersectRayOBBPacket(const Vector3& pos, const Vector3& dir, const OBBPacket& boxes, uint64_t* hit_mask, float* nearest_t) {
+
+		const uint32_t num = boxes.size();
+		RayPacketClear(hit_mask, num);
+
+		const float* bmin[3] = { boxes.min_x_.data(), boxes.min_y_.data(), boxes.min_z_.data() };
+		const float* bmax[3] = { boxes.max_x_.data(), boxes.max_y_.data(), boxes.max_z_.data() };
+		const float* inv[4][3];
+		for (int r = 0; r < 4; ++r) {
+			for (int c = 0; c < 3; ++c) inv[r][c] = boxes.inv_[r][c].data();
+		}
+
+		int nearest = -1;
+		float t_near = FLT_MAX;
+		uint32_t n = 0;
+
+#if defined(TNL_SIMD_AVX2)
+		// {bNXɃ[JԂ̃CقȂ̂ŕs̓[̃}XNōs
+		const __m256 wp[3] = { _mm256_set1_ps(pos.x), _mm256_set1_ps(pos.y), _mm256_set1_ps(pos.z) };
+		const __m256 wd[3] = { _mm256_set1_ps(dir.x), _mm256_set1_ps(dir.y), _mm256_set1_ps(dir.z) };
+		const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+		const __m256 eps = _mm256_set1_ps(FLT_EPSILON);
+		for (; n + 8 <= num; n += 8) {
+			__m256 t_min = _mm256_set1_ps(-FLT_MAX);
+			__m256 t_max = _mm256_set1_ps(FLT_MAX);
+			__m256 valid = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+			for (int i = 0; i < 3; ++i) {
+				__m256 m0 = _mm256_loadu_ps(inv[0][i] + n);
+				__m256 m1 = _mm256_loadu_ps(inv[1][i] + n);
+				__m256 m2 = _mm256_loadu_ps(inv[2][i] + n);
+				__m256 m3 = _mm256_loadu_ps(inv[3][i] + n);
+				__m256 lp = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(wp[0], m0), _mm256_mul_ps(wp[1], m1)), _mm256_add_ps(_mm256_mul_ps(wp[2], m2), m3));
+				__m256 ld = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(wd[0], m0), _mm256_mul_ps(wd[1], m1)), _mm256_mul_ps(wd[2], m2));
+
+				__m256 mn = _mm256_loadu_ps(bmin[i] + n);
+				__m256 mx = _mm256_loadu_ps(bmax[i] + n);
+				__m256 parallel = _mm256_cmp_ps(_mm256_and_ps(ld, abs_mask), eps, _CMP_LT_OQ);
+				__m256 inside = _mm256_and_ps(_mm256_cmp_ps(lp, mn, _CMP_GE_OQ), _mm256_cmp_ps(lp, mx, _CMP_LE_OQ));
+				valid = _mm256_and_ps(valid, _mm256_or_ps(_mm256_andnot_ps(parallel, valid), inside));
+
+				__m256 ood = _mm256_div_ps(_mm256_set1_ps(1.0f), ld);
+				__m256 t1 = _mm256_mul_ps(_mm256_sub_ps(mn, lp), ood);
+				__m256 t2 = _mm256_mul_ps(_mm256_sub_ps(mx, lp), ood);
+				t_min = _mm256_blendv_ps(_mm256_max_ps(t_min, _mm256_min_ps(t1, t2)), t_min, parallel);
+				t_max = _mm256_blendv_ps(_mm256_min_ps(t_max, _mm256_max_ps(t1, t2)), t_max, parallel);
+			}
+			valid = _mm256_and_ps(valid, _mm256_cmp_ps(t_min, t_max, _CMP_LT_OQ));
+			RayPacketRecord8(n, _mm256_movemask_ps(valid), t_min, hit_mask, nearest, t_near);
+		}
+#endif
+
+		// [ ( XJ[ł͑S{bNX )
+		for (; n < num; ++n) {
+			float p[3], d[3];
+			for (int i = 0; i < 3; ++i) {
+				p[i] = pos.x * inv[0][i][n] + pos.y * inv[1][i][n] + pos.z * inv[2][i][n] + inv[3][i][n];
+				d[i] = dir.x * inv[0][i][n] + dir.y * inv[1][i][n] + dir.z * inv[2][i][n];
+			}
+			const float mn[3] = { bmin[0][n], bmin[1][n], bmin[2][n] };
+			const float mx[3] = { bmax[0][n], bmax[1][n], bmax[2][n] };
+			float t;
+			if (RayBoxSlab(p, d, mn, mx, -FLT_MAX, true, t)) RayPacketRecord(n, t, hit_mask, nearest, t_near);
+		}
+
+		if (nearest_t && nearest >= 0) *nearest_t = t_near;
+		return nearest;
+	}
+
+
+	//----------------------------------------------------------------------------------------------
+	void TorusPacket::add(const Vector3& tp, const Quaternion& tq, const float tube_r, const float swept_r) {
+		pos_x_.emplace_back(tp.x); pos_y_.emplace_back(tp.y); pos_z_.emplace_back(tp.z);
+		bound_r_.emplace_back(fabsf(swept_r) + fabsf(tube_r));
+		rot_.emplace_back(tq.x, tq.y, tq.z, tq.w);
+		tube_r_.emplace_back(tube_r);
+		swept_r_.emplace_back(swept_r);
+	}
+	void TorusPacket::clear() noexcept {
+		pos_x_.clear(); pos_y_.clear(); pos_z_.clear();
+		bound_r_.clear(); rot_.clear();
+		tube_r_.clear(); swept_r_.clear();
+	}
+
+	// OڋŏOȂg[X 1 ̔
+	static void RayTorusPacketOne(const Vector3& pos, const Vector3& dir, const TorusPacket& tori, const uint32_t n, uint64_t* hit_mask, int& nearest, float& t_near) {
+		const Float4& r = tori.rot_[n];
+		double solution[4];
+		int num = RayTorusSolve(pos, dir, { tori.pos_x_[n], tori.pos_y_[n], tori.pos_z_[n] }, Quaternion(r.x, r.y, r.z, r.w), tori.tube_r_[n], tori.swept_r_[n], solution);
+		if (0 == num) return;
+		double t = RayTorusNearest(solution, num);
+		if (DBL_MAX == t) {
+			// ƂĂ͌Ă邪Č
+			if (hit_mask) hit_mask[n >> 6] |= (1ULL << (n & 63));
+			return;
+		}
+		RayPacketRecord(n, static_cast<float>(t), hit_mask, nearest, t_near);
 	}
 
+	//----------------------------------------------------------------------------------------------
+	// OڋƃC (  ) ̋ő唼OAc肾{x 4 
+	// O̔͐l덷ŉ肱ڂȂ悤Oڋ͂ɑ傫čs
+	int IsIntersectRayTorusPacket(const Vector3& pos, const Vector3& dir, const TorusPacket& tori, uint64_t* hit_mask, float* nearest_t) {
+
+		const uint32_t num = tori.size();
+		RayPacketClear(hit_mask, num);
+
+		const float* cx = tori.pos_x_.data();
+		const float* cy = tori.pos_y_.data();
+		const float* cz = tori.pos_z_.data();
+		const float* br = tori.bound_r_.data();
+		const float rdd = 1.0f / (dir.x * dir.x + dir.y * dir.y + dir.z * dir.z);
+		const float BOUND_SCALE = 1.001f;
+		const float BOUND_BIAS = 1.0e-4f;
+
+		int nearest = -1;
+		float t_near = FLT_MAX;
+		uint32_t n = 0;
+
+#if defined(TNL_SIMD_AVX2)
+		const __m256 wp[3] = { _mm256_set1_ps(pos.x), _mm256_set1_ps(pos.y), _mm256_set1_ps(pos.z) };
+		const __m256 wd[3] = { _mm256_set1_ps(dir.x), _mm256_set1_ps(dir.y), _mm256_set1_ps(dir.z) };
+		const __m256 w_rdd = _mm256_set1_ps(rdd);
+		const __m256 w_scale = _mm256_set1_ps(BOUND_SCALE);
+		const __m256 w_bias = _mm256_set1_ps(BOUND_BIAS);
+		for (; n + 8 <= num; n += 8) {
+			__m256 ox = _mm256_sub_ps(wp[0], _mm256_loadu_ps(cx + n));
+			__m256 oy = _mm256_sub_ps(wp[1], _mm256_loadu_ps(cy + n));
+			__m256 oz = _mm256_sub_ps(wp[2], _mm256_loadu_ps(cz + n));
+			__m256 oo = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ox, ox), _mm256_mul_ps(oy, oy)), _mm256_mul_ps(oz, oz));
+			__m256 od = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ox, wd[0]), _mm256_mul_ps(oy, wd[1])), _mm256_mul_ps(oz, wd[2]));
+			__m256 dist_sq = _mm256_sub_ps(oo, _mm256_mul_ps(_mm256_mul_ps(od, od), w_rdd));
+			__m256 r = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(br + n), w_scale), w_bias);
+			int lane_mask = _mm256_movemask_ps(_mm256_cmp_ps(dist_sq, _mm256_mul_ps(r, r), _CMP_LE_OQ));
+			for (int k : BitRange64(static_cast<uint32_t>(lane_mask))) {
+				RayTorusPacketOne(pos, dir, tori, n + k, hit_mask, nearest, t_near);
+			}
+		}
+#endif
+
+		// [ ( XJ[ł͑Sg[X )
+		for (; n < num; ++n) {
+			float ox = pos.x - cx[n], oy = pos.y - cy[n], oz = pos.z - cz[n];
+			float od = ox * dir.x + oy * dir.y + oz * dir.z;
+			float dist_sq = (ox * ox + oy * oy + oz * oz) - od * od * rdd;
+			float r = br[n] * BOUND_SCALE + BOUND_BIAS;
+			if (dist_sq > r * r) continue;
+			RayTorusPacketOne(pos, dir, tori, n, hit_mask, nearest, t_near);
+		}
+
+		if (nearest_t && nearest >= 0) *nearest_t = t_near;
+		return nearest;
+	}
 
 }
\ No newline at end of file
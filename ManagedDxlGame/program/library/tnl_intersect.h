@@ -86,6 +86,41 @@ namespace tnl {
 	// ret.... [Փ˂Ă : true] [Փ˂ĂȂ : false]
 	bool IsIntersectAABB( const tnl::Vector3& a, const tnl::Vector3& a_size, const tnl::Vector3& b, const tnl::Vector3& b_size );
 
+	//----------------------------------------------------------------------------------------------
+	// work... ړ AABB (A) ƓȂ AABB (B) ̘AՓ˔ ( XEFvg AABB )
+	// arg1... ړO A W
+	// arg2... A ̈ړxNg
+	// arg3... A ̃TCY
+	// arg4... B ̍W
+	// arg5... B ̃TCY
+	// arg6... Փˎ̎󂯎p ( 0.0f ` 1.0f ړxNgɑ΂銄 ) ( ȗ )
+	// arg7... Փ˖ʂ̖@̎󂯎p ( B ̕\ʂ A Ԃ̎PʃxNg ) ( ȗ )
+	// ret.... [Փ˂Ă : true] [Փ˂ĂȂ : false]
+	// tips... ړ̓rŐڐG鎞߂̂ŁAǂ⍂ȃIuWFNgł蔲܂
+	//         ʓmڂĂ邾ňړʂɉĂꍇ͏Փ˂Ƃ݂Ȃ܂
+	//         ړOdȂĂꍇ  0  ł󂭉o鎲̖@Ԃ܂
+	bool IsIntersectSweptAABB(const tnl::Vector3& a_prev, const tnl::Vector3& a_move, const tnl::Vector3& a_size,
+		const tnl::Vector3& b, const tnl::Vector3& b_size, float* out_time = nullptr, tnl::Vector3* out_normal = nullptr);
+
+	//----------------------------------------------------------------------------------------------
+	// work... ړ AABB (A)  Ȃ AABB Q (B) ɉĊ点ړ̍W擾
+	// arg1... ړO A W
+	// arg2... A ̈ړxNg
+	// arg3... A ̃TCY
+	// arg4... B ̍Wz
+	// arg5... B ̃TCYz
+	// arg6... B ̐
+	// arg7... ړ̍W
+	// arg8... Փ˖Ɉړł؂Ċ点ő ( ftHg 3 )
+	// ret.... Փ˂ ( o B ̐܂ 0 ̏ꍇ͏Փ˂Ȃ ړOW + ړxNg )
+	// tips... ړOdȂĂ B ΁A B Ƃɍł󂭉o鎲̕։o܂
+	//         ( oŕʂ B ɏdȂꍇ܂ł͉܂ )
+	// tips... IsIntersectSweptAABB ōŏɓ B TĐڐGʒu܂Ői
+	//         c̈ړ@̐菜čēx肷鎖JԂ܂
+	//         ŒXebv̍XV GetCorrectPositionIntersectAABB ̑Ɏgp܂
+	int GetCorrectPositionSweptAABB(const tnl::Vector3& a_prev, const tnl::Vector3& a_move, const tnl::Vector3& a_size,
+		const tnl::Vector3* b, const tnl::Vector3* b_size, const uint32_t b_num, tnl::Vector3& out, const int max_iteration = 3);
+
 
 	//----------------------------------------------------------------------------------------------
 	// work... 2D̐̔
@@ -188,4 +223,97 @@ namespace tnl {
 	bool IsIntersectRayTorus(const Vector3& s, const Vector3& dir, const Vector3& tp, const Quaternion& tq, const float tube_r, const float swept_r);
 	bool IsIntersectRayTorus(const Vector3& s, const Vector3& dir, const Vector3& tp, const Quaternion& tq, const float tube_r, const float swept_r, Vector3& intersect_pos);
 
+
+	//----------------------------------------------------------------------------------------------
+	// work... Cƕ AABB ̈ꊇp{bNXz
+	// tips... e SoA ŕێ܂
+	//         IsIntersectRayAABBPacket ɓnĎgpĂ
+	struct AABBPacket final {
+		std::vector<float> min_x_, min_y_, min_z_;
+		std::vector<float> max_x_, max_y_, max_z_;
+
+		// arg1... ̍W
+		// arg2... EO̍W
+		void add(const Vector3& aabb_max, const Vector3& aabb_min);
+		void clear() noexcept;
+		inline uint32_t size() const noexcept { return static_cast<uint32_t>(min_x_.size()); }
+	};
+
+	//----------------------------------------------------------------------------------------------
+	// work... Cƕ OBB ̈ꊇp{bNXz
+	// tips... {bNX AABB  OBB p̋ts SoA ŕێ܂
+	//         IsIntersectRayOBBPacket ɓnĎgpĂ
+	struct OBBPacket final {
+		std::vector<float> min_x_, min_y_, min_z_;
+		std::vector<float> max_x_, max_y_, max_z_;
+		// inv_[ s ][  ] ... p̋ts _11 ` _43
+		std::vector<float> inv_[4][3];
+
+		// arg1... {bNXAABB Ƃ ̍W
+		// arg2... {bNXAABB Ƃ EO̍W
+		// arg3... OBB ̉]s ( IsIntersectRayOBB Ɠ )
+		void add(const Vector3& aabb_max, const Vector3& aabb_min, const Matrix& obb_rot);
+		void clear() noexcept;
+		inline uint32_t size() const noexcept { return static_cast<uint32_t>(min_x_.size()); }
+	};
+
+	//----------------------------------------------------------------------------------------------
+	// work... Cƕ AABB ̈ꊇՓ˔
+	// arg1... CW
+	// arg2... CxNg
+	// arg3... {bNXz
+	// arg4... Փ˂{bNX̃rbg𗧂Ă}XN ( ( size + 63 ) / 64 vf, O 0 NA܂, ȗ )
+	// arg5... ł߂_̃C̋ ( ȗ )
+	// ret.... [ ł߂Փ˃{bNX̃CfbNX ] [ Փ˂Ȃ : -1 ]
+	// tips... X̔茋ʂ IsIntersectRayAABB Ɠł
+	//         AVX2 ł 8 {bNX܂Ƃ߂Ĕ肵܂
+	int IsIntersectRayAABBPacket(const Vector3& pos, const Vector3& dir, const AABBPacket& boxes, uint64_t* hit_mask = nullptr, float* nearest_t = nullptr);
+
+	//----------------------------------------------------------------------------------------------
+	// work... Cƕ OBB ̈ꊇՓ˔
+	// arg1... CW
+	// arg2... CxNg
+	// arg3... {bNXz
+	// arg4... Փ˂{bNX̃rbg𗧂Ă}XN ( ( size + 63 ) / 64 vf, O 0 NA܂, ȗ )
+	// arg5... ł߂_̃C̋ ( ȗ )
+	// ret.... [ ł߂Փ˃{bNX̃CfbNX ] [ Փ˂Ȃ : -1 ]
+	// tips... X̔茋ʂ IsIntersectRayOBB Ɠł
+	//         _ pos + dir * nearest_t ŋ܂܂
+	//         AVX2 ł 8 {bNX܂Ƃ߂Ĕ肵܂
+	int IsIntersectRayOBBPacket(const Vector3& pos, const Vector3& dir, const OBBPacket& boxes, uint64_t* hit_mask = nullptr, float* nearest_t = nullptr);
+
+
+	//----------------------------------------------------------------------------------------------
+	// work... Cƕg[Ẍꊇpg[Xz
+	// tips... WƊOڋ̔a SoA ŕێ܂
+	//         IsIntersectRayTorusPacket ɓnĎgpĂ
+	struct TorusPacket final {
+		std::vector<float> pos_x_, pos_y_, pos_z_;
+		std::vector<float> bound_r_;	// Oڋ̔a ( ւ̔a + Ŝ̔a )
+		std::vector<Float4> rot_;
+		std::vector<float> tube_r_, swept_r_;
+
+		// arg1... g[XSW
+		// arg2... g[Xp
+		// arg3... g[X̗ւ̔a
+		// arg4... g[XŜ̔a
+		void add(const Vector3& tp, const Quaternion& tq, const float tube_r, const float swept_r);
+		void clear() noexcept;
+		inline uint32_t size() const noexcept { return static_cast<uint32_t>(pos_x_.size()); }
+	};
+
+	//----------------------------------------------------------------------------------------------
+	// work... Cƕg[ẌꊇՓ˔
+	// arg1... CW
+	// arg2... CxNg
+	// arg3... g[Xz
+	// arg4... Փ˂g[X̃rbg𗧂Ă}XN ( ( size + 63 ) / 64 vf, ȗ )
+	// arg5... ł߂_̃C̋ ( ȗ )
+	// ret.... [ ł߂Փ˃g[X̃CfbNX ] [ Փ˂Ȃ : -1 ]
+	// tips... }XN̔茋ʂ IsIntersectRayTorus Ɠł ( Cł̌܂݂܂ )
+	//         ߂l arg5 ̓CǑ_݂̂ΏۂŁA_ pos + dir * nearest_t ŋ܂܂
+	//         OڋŏOg[XȊO͔{x 4 ̂Őx͒P̂̔Ɠł
+	//         AVX2 ł͊Oڋ̔ 8 g[X܂Ƃ߂čs܂
+	int IsIntersectRayTorusPacket(const Vector3& pos, const Vector3& dir, const TorusPacket& tori, uint64_t* hit_mask = nullptr, float* nearest_t = nullptr);
+
 }
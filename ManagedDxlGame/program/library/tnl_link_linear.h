@@ -1,6 +1,8 @@
 #pragma once
 #include <memory>
 #include <functional>
+#include <vector>
+#include <type_traits>
 #include "tnl_instance.h"
 
 
@@ -34,12 +36,61 @@ void gameMain(float deltatime) {
 }
 */
 
+    //-------------------------------------------------------------------------------------------------------------------
+    // rl̔zQƂŸ\[g ( {gAbv}[W\[g )
+    // arg1... בւY ( keys ̓Y )
+    // arg2... Ɨpz ( num  )
+    // arg3... rl̔z
+    // arg4... vf
+    // arg5... r֐ ( std::less  )
+    // tips... link_linear / LinkLinearPool ̃\[gŎgp܂
+    template< class KeyType, class Compare >
+    inline void LinkLinearMergeSort(uint32_t* order, uint32_t* work, const KeyType* keys, const uint32_t num, Compare comp) {
+        constexpr uint32_t RUN = 16;
+
+        // ZԂ͑}\[g
+        for (uint32_t s = 0; s < num; s += RUN) {
+            uint32_t e = (s + RUN < num) ? s + RUN : num;
+            for (uint32_t i = s + 1; i < e; ++i) {
+                uint32_t v = order[i];
+                uint32_t k = i;
+                while (k > s && comp(keys[v], keys[order[k - 1]])) {
+                    order[k] = order[k - 1];
+                    --k;
+                }
+                order[k] = v;
+            }
+        }
+
+        // ԕ{ɂȂ畹 ( E̋ԂEɏôň )
+        uint32_t* src = order;
+        uint32_t* dst = work;
+        for (uint32_t width = RUN; width < num; width *= 2) {
+            for (uint32_t s = 0; s < num; s += width * 2) {
+                uint32_t m = (s + width < num) ? s + width : num;
+                uint32_t e = (m + width < num) ? m + width : num;
+                uint32_t l = s, r = m, o = s;
+                while (l < m && r < e) dst[o++] = comp(keys[src[r]], keys[src[l]]) ? src[r++] : src[l++];
+                while (l < m) dst[o++] = src[l++];
+                while (r < e) dst[o++] = src[r++];
+            }
+            std::swap(src, dst);
+        }
+        if (src != order) {
+            for (uint32_t i = 0; i < num; ++i) order[i] = src[i];
+        }
+    }
+
+
 	//-------------------------------------------------------------------------------------------------------------------
 	//
 	// o`Xg\
 	// tips... pĎgp邱Ƃz肵XgNX
 	// tips... ̃NXpꍇ shared_ptr łpł܂
 	// tips... zQƂ邽 prev  weak_ptr ɂȂĂ܂A擪m[h͏ɕێĂ
+	// tips... 擪EŌEvf̓Xg̃m[hŋLĂ̂ getFront / getBack / getSize  O(1) ł
+	// tips... hNX̃CX^X̂܂܃m[hɂ邽 LinkLinearPool ̂悤ȃXbgzɂ͊i[܂
+	//         shared_ptr ŌʂɏLKv̖vf̃Xgɂ LinkLinearPool gpĂ
     //
     TNL_SHARED_FACTORY_CLASS(link_linear, Instance)
     public:
@@ -49,129 +100,69 @@ void gameMain(float deltatime) {
     protected:
         link_linear() {}
 
+        // QƃJEg𑝂₳Ɏ擾 ( hNXł̑p )
+        inline link_linear* getNextPtr() const noexcept { return next_.get(); }
+
     private:
+        // Xgɑm[hŋL
+        struct Chain {
+            link_linear* front_;
+            link_linear* back_;
+            uint32_t size_;
+        };
+
         weak prev_;
         shared next_ = nullptr;
+        std::shared_ptr<Chain> chain_ = nullptr;	// XgɌqĂȂPƂ̃m[h nullptr
+
+        inline shared sharedFromThis() { return std::static_pointer_cast<link_linear>(shared_from_this()); }
 
-        static shared Swap(shared a, shared b, shared& front) {
-            shared ap, an;
-            shared bp, bn;
-            shared sa = a;
-            shared sb = b;
-            if (a->getPrev()) ap = a->getPrev();
-            if (a->getNext()) an = a->getNext();
-            if (b->getPrev()) bp = b->getPrev();
-            if (b->getNext()) bn = b->getNext();
-            if (an == b) {
-                if (ap) ap->next_ = b;
-                if (bn) bn->prev_ = a;
-                a->prev_ = b;
-                a->next_ = bn;
-                b->prev_ = ap;
-                b->next_ = a;
-                front = (b->getPrev()) ? front : b;
-                return front;
+        template< class CompType, class Compare >
+        static shared Sort(shared node, const std::function<CompType(shared)>& get_comp_vlue, Compare comp) {
+            std::vector<shared> nodes;
+            std::vector<CompType> keys;
+            for (shared obj = node->getFront(); obj; obj = obj->next_) {
+                keys.emplace_back(get_comp_vlue(obj));
+                nodes.emplace_back(obj);
             }
-            if (bn == a) {
-                if (an) an->prev_ = b;
-                if (bp) bp->next_ = a;
-                a->prev_ = bp;
-                a->next_ = b;
-                b->prev_ = a;
-                b->next_ = an;
-                front = (a->getPrev()) ? front : a;
-                return front;
+            uint32_t num = static_cast<uint32_t>(nodes.size());
+            std::vector<uint32_t> order(num), work(num);
+            for (uint32_t i = 0; i < num; ++i) order[i] = i;
+            LinkLinearMergeSort(order.data(), work.data(), keys.data(), num, comp);
+
+            // ёւɌq
+            for (uint32_t i = 0; i < num; ++i) {
+                shared& obj = nodes[order[i]];
+                obj->prev_ = (i > 0) ? nodes[order[i - 1]] : weak();
+                obj->next_ = (i + 1 < num) ? nodes[order[i + 1]] : nullptr;
             }
-            if (ap) ap->next_ = b;
-            if (an) an->prev_ = b;
-            if (bp) bp->next_ = a;
-            if (bn) bn->prev_ = a;
-            a->prev_ = bp;
-            a->next_ = bn;
-            b->prev_ = ap;
-            b->next_ = an;
-            front = (a->getPrev()) ? front : a;
-            front = (b->getPrev()) ? front : b;
-            return front;
-        }
-
-        template< class CompType >
-        static shared Sort_ascending(shared& old_front, shared s, shared e, const std::function<CompType(shared)>& comp_vlue) {
-            if (s == e) return old_front;
-
-            CompType pivot = comp_vlue(s);
-
-            shared p1 = s;
-            shared p2 = e;
-            shared new_front;
-
-            while (1) {
-                if (comp_vlue(p1) >= pivot && comp_vlue(p2) < pivot) {
-                    if (s == p1) s = p2;
-                    if (e == p2) e = p1;
-                    new_front = Swap(p1, p2, old_front);
-                    std::swap(p1, p2);
-                }
-                if (comp_vlue(p1) < pivot) {
-                    p1 = p1->getNext();
-                    if (p1 == p2) { break; }
-                }
-                if (comp_vlue(p2) >= pivot) {
-                    p2 = p2->getPrev();
-                    if (p1 == p2) { break; }
-                }
+            if (node->chain_) {
+                node->chain_->front_ = nodes[order[0]].get();
+                node->chain_->back_ = nodes[order[num - 1]].get();
             }
-
-            if (p1->getPrev() && p1 != s && comp_vlue(p1) >= pivot) p1 = p1->getPrev();
-            else if (p2->getNext() && p2 != e) p2 = p2->getNext();
-
-            new_front = Sort_ascending(old_front, s, p1, comp_vlue);
-            new_front = Sort_ascending(old_front, p2, e, comp_vlue);
-
-            return new_front;
+            return nodes[order[0]];
         }
 
-        template< class CompType >
-        static shared Sort_descending(shared& old_front, shared s, shared e, const std::function<CompType(shared)>& comp_vlue) {
-            if (s == e) return old_front;
-
-            CompType pivot = comp_vlue(s);
 
-            shared p1 = s;
-            shared p2 = e;
-            shared new_front;
+    public:
 
-            while (1) {
-                if (comp_vlue(p1) <= pivot && comp_vlue(p2) > pivot) {
-                    if (s == p1) s = p2;
-                    if (e == p2) e = p1;
-                    new_front = Swap(p1, p2, old_front);
-                    std::swap(p1, p2);
-                }
-                if (comp_vlue(p1) > pivot) {
-                    p1 = p1->getNext();
-                    if (p1 == p2) { break; }
-                }
-                if (comp_vlue(p2) <= pivot) {
-                    p2 = p2->getPrev();
-                    if (p1 == p2) { break; }
-                }
+        virtual ~link_linear() {
+            shared next = std::move(next_);
+            if (chain_) {
+                // Õm[hɕێĂԂ͉Ȃ̂ŁÂ͏ɐ擪
+                if (chain_->front_ == this) chain_->front_ = next.get();
+                if (chain_->back_ == this) chain_->back_ = nullptr;
+                --chain_->size_;
+            }
+            // 㑱 1 ؂藣ĂAXgłfXgN^ċAȂ悤ɂ
+            while (next && next.use_count() == 1) {
+                shared after = std::move(next->next_);
+                next.reset();
+                if (chain_) chain_->front_ = after.get();
+                next = std::move(after);
             }
-
-            if (p1->getPrev() && p1 != s && comp_vlue(p1) <= pivot) p1 = p1->getPrev();
-            else if (p2->getNext() && p2 != e) p2 = p2->getNext();
-
-            new_front = Sort_descending(old_front, s, p1, comp_vlue);
-            new_front = Sort_descending(old_front, p2, e, comp_vlue);
-
-            return new_front;
         }
 
-
-    public:
-
-        virtual ~link_linear() {}
-
         //-----------------------------------------------------------------------------------------------------
         // O̎擾
         inline shared getNext() const noexcept {
@@ -186,22 +177,14 @@ void gameMain(float deltatime) {
         //-----------------------------------------------------------------------------------------------------
         // 擪̎擾
         inline shared getFront() noexcept {
-            shared front = std::static_pointer_cast<link_linear>( shared_from_this() );
-            while (front->getPrev()) {
-                front = front->getPrev();
-            }
-            return front;
+            return chain_ ? chain_->front_->sharedFromThis() : sharedFromThis();
         }
 
 
         //-----------------------------------------------------------------------------------------------------
         // Ō̎擾
         inline shared getBack() noexcept {
-            shared back = std::static_pointer_cast<link_linear>(shared_from_this());
-            while (back->next_) {
-                back = back->next_;
-            }
-            return back;
+            return chain_ ? chain_->back_->sharedFromThis() : sharedFromThis();
         }
 
         //-----------------------------------------------------------------------------------------------------
@@ -212,6 +195,12 @@ void gameMain(float deltatime) {
             shared next = getNext();
             if (next) next->prev_ = prev;
             if (prev) prev->next_ = next;
+            if (chain_) {
+                if (chain_->front_ == this) chain_->front_ = next.get();
+                if (chain_->back_ == this) chain_->back_ = prev.get();
+                --chain_->size_;
+                chain_.reset();
+            }
 			prev_.reset();
 			next_.reset();
             return next;
@@ -219,20 +208,37 @@ void gameMain(float deltatime) {
 
         //-----------------------------------------------------------------------------------------------------
         // ǉ
-        inline void pushBack(const shared& add) noexcept {
+        // tips... add ȍ~ɌqĂm[hꏏɒǉ܂
+        //         add ʂ̃Xg̓rɂꍇ́ÃXg add ̑OŐ؂藣܂
+        inline void pushBack(const shared& add) {
+            if (!chain_) chain_ = std::make_shared<Chain>(Chain{ this, this, 1 });
             shared last = getBack();
+
+            std::shared_ptr<Chain> old = add->chain_;
+            shared prev = add->getPrev();
+            link_linear* back = add.get();
+            uint32_t num = 0;
+            for (link_linear* obj = add.get(); obj; obj = obj->next_.get()) {
+                obj->chain_ = chain_;
+                back = obj;
+                ++num;
+            }
+            if (old) {
+                old->back_ = prev.get();
+                old->size_ -= num;
+            }
+            if (prev) prev->next_ = nullptr;
+
             last->next_ = add;
             add->prev_ = last;
+            chain_->back_ = back;
+            chain_->size_ += num;
         }
 
         //-----------------------------------------------------------------------------------------------------
         // TCY擾
-        inline uint32_t getSize() {
-			shared obj = getFront();
-			for (uint32_t i = 1; ; ++i) {
-				obj = obj->getNext();
-				if (!obj) return i;
-			}
+        inline uint32_t getSize() const noexcept {
+			return chain_ ? chain_->size_ : 1;
 		}
 
         //-----------------------------------------------------------------------------------------------------
@@ -251,8 +257,8 @@ void gameMain(float deltatime) {
         // arg1... Xĝꂩ̃m[h
         // arg2... r֐ ( ɍv true Ԃ_֐ )
         // ret.... ɍvm[hXg
-        static std::list<shared> Find(shared node, const std::function<bool(shared)>& comp) noexcept {
-            std::list<shared> tbl ;
+        static std::vector<shared> Find(shared node, const std::function<bool(shared)>& comp) {
+            std::vector<shared> tbl ;
             shared check = node->getFront();
             while (check) {
                 if (comp(check)) tbl.emplace_back( check );
@@ -269,20 +275,252 @@ void gameMain(float deltatime) {
         // arg2... \[g̔rɎgplԂ_֐
         // ret.... \[gʂ̐擪m[h
         // tips... prev  weak_ptr ŕێĂ֌WŃ\[gs̐擪m[h͖߂lŏ㏑鎖
+        // tips... rl̓m[h 1 x擾Al̃m[h͌̏ۂ܂ ( \[g )
         template< class DerivedType, class CompType >
 		static std::shared_ptr<DerivedType> SortAscending(shared node, const std::function<CompType(shared)>& get_comp_vlue) {
-            shared front = node->getFront() ;
-            shared back = node->getBack() ;
-            return std::static_pointer_cast<DerivedType>(Sort_ascending( front, front, back, get_comp_vlue) );
+            return std::static_pointer_cast<DerivedType>(Sort(node, get_comp_vlue, std::less<CompType>()));
 		}
         template< class DerivedType, class CompType >
         static std::shared_ptr<DerivedType> SortDescending(shared node, const std::function<CompType(shared)>& get_comp_vlue) {
-            shared front = node->getFront();
-            shared back = node->getBack();
-            return std::static_pointer_cast<DerivedType>(Sort_descending( front, front, back, get_comp_vlue));
+            return std::static_pointer_cast<DerivedType>(Sort(node, get_comp_vlue, std::greater<CompType>()));
         }
 
     };
 
-}
 
+    //-------------------------------------------------------------------------------------------------------------------
+    //
+    // o`Xg\ ( v[ )
+    // tips... link_linear Ɠ shared_ptr g킸ɍsXgNX
+    // tips... vf͘AXbgzɊi[Am[h 32 bit ̃nhŎw܂
+    //         nh [  :  12 bit ][ Xbgԍ :  20 bit ] ŁA폜ς݂̃nh isValid  false ɂȂ܂
+    // tips... 擪EŌEvf͕ێĂ̂ getFront / getBack / getSize  O(1) ł
+    // tips... 폜Xbg͍ėp܂Avf̈ړ͍sȂ̂Ń\[gnh͗Lł
+    // tips... T ̓ftHg\z\ł鎖 ( 폜ɃftHglŏ㏑ĕێĂ鎑܂ )
+    //
+    /*
+        tnl::LinkLinearPool<int> list;
+        for (int i = 0; i < 30; ++i) list.pushBack( rand() % 50 );
+        list.sortAscending( [](int n) { return n; } );
+        for (auto h = list.getFront(); list.isValid(h); h = list.getNext(h)) {
+            printf("%d\n", list[h]);
+        }
+    */
+    template< class T >
+    class LinkLinearPool final {
+    public:
+        using handle = uint32_t;
+        static constexpr handle INVALID_HANDLE = 0xffffffff;
+
+        LinkLinearPool() {}
+        explicit LinkLinearPool(const uint32_t reserve_num) { reserve(reserve_num); }
+
+        //-----------------------------------------------------------------------------------------------------
+        // nhL
+        inline bool isValid(const handle h) const noexcept {
+            uint32_t idx = h & INDEX_MASK;
+            if (idx >= links_.size()) return false;
+            return links_[idx].generation_ == (h >> INDEX_BITS) && links_[idx].is_used_;
+        }
+
+        //-----------------------------------------------------------------------------------------------------
+        // vf̎擾
+        inline T& get(const handle h) noexcept { return values_[h & INDEX_MASK]; }
+        inline const T& get(const handle h) const noexcept { return values_[h & INDEX_MASK]; }
+        inline T& operator[](const handle h) noexcept { return values_[h & INDEX_MASK]; }
+        inline const T& operator[](const handle h) const noexcept { return values_[h & INDEX_MASK]; }
+
+        //-----------------------------------------------------------------------------------------------------
+        // OE擪EŌ̎擾
+        // tips... ݂Ȃꍇ INVALID_HANDLE
+        inline handle getNext(const handle h) const noexcept { return toHandle(links_[h & INDEX_MASK].next_); }
+        inline handle getPrev(const handle h) const noexcept { return toHandle(links_[h & INDEX_MASK].prev_); }
+        inline handle getFront() const noexcept { return toHandle(front_); }
+        inline handle getBack() const noexcept { return toHandle(back_); }
+
+        //-----------------------------------------------------------------------------------------------------
+        // TCY擾
+        inline uint32_t getSize() const noexcept { return size_; }
+        inline bool isEmpty() const noexcept { return 0 == size_; }
+
+        //-----------------------------------------------------------------------------------------------------
+        // 擪OԂƂĎwm[hXg̉Ԗڂ
+        inline uint32_t getOrder(const handle h) const noexcept {
+            uint32_t n = 0;
+            for (uint32_t idx = links_[h & INDEX_MASK].prev_; idx != NONE; idx = links_[idx].prev_) ++n;
+            return n;
+        }
+
+        //-----------------------------------------------------------------------------------------------------
+        // ǉ
+        // ret.... ǉm[h̃nh
+        inline handle pushBack(const T& value) { return insert(NONE, allocSlot(value)); }
+        inline handle pushBack(T&& value) { return insert(NONE, allocSlot(std::move(value))); }
+        inline handle pushFront(const T& value) { return insert(front_, allocSlot(value)); }
+        inline handle pushFront(T&& value) { return insert(front_, allocSlot(std::move(value))); }
+
+        //-----------------------------------------------------------------------------------------------------
+        // wm[h̑Oɒǉ
+        inline handle insertBefore(const handle h, const T& value) { return insert(h & INDEX_MASK, allocSlot(value)); }
+        inline handle insertBefore(const handle h, T&& value) { return insert(h & INDEX_MASK, allocSlot(std::move(value))); }
+
+        //-----------------------------------------------------------------------------------------------------
+        // E
+        // ret... ̃m[h
+        inline handle pop(const handle h) noexcept {
+            uint32_t idx = h & INDEX_MASK;
+            Link& link = links_[idx];
+            uint32_t next = link.next_;
+            if (link.prev_ != NONE) links_[link.prev_].next_ = link.next_;
+            else front_ = link.next_;
+            if (link.next_ != NONE) links_[link.next_].prev_ = link.prev_;
+            else back_ = link.prev_;
+
+            values_[idx] = T();
+            link.is_used_ = false;
+            link.generation_ = (link.generation_ + 1) & GENERATION_MASK;
+            link.prev_ = NONE;
+            link.next_ = free_;
+            free_ = idx;
+            --size_;
+            return toHandle(next);
+        }
+
+        //-----------------------------------------------------------------------------------------------------
+        // S폜
+        // tips... sς݂̃nh͑SĖɂȂ܂
+        inline void clear() noexcept {
+            for (uint32_t idx = front_; idx != NONE; ) {
+                uint32_t next = links_[idx].next_;
+                pop(toHandle(idx));
+                idx = next;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------------------
+        // Xbg̎Om
+        inline void reserve(const uint32_t num) {
+            values_.reserve(num);
+            links_.reserve(num);
+        }
+
+        //-----------------------------------------------------------------------------------------------------
+        // 
+        // arg1... r֐ ( ɍv true Ԃ_֐ )
+        // ret.... ɍvm[h̃nh ( Xg̏ )
+        template< class Comp >
+        std::vector<handle> find(Comp comp) const {
+            std::vector<handle> tbl;
+            for (uint32_t idx = front_; idx != NONE; idx = links_[idx].next_) {
+                if (comp(values_[idx])) tbl.emplace_back(toHandle(idx));
+            }
+            return tbl;
+        }
+
+        //-----------------------------------------------------------------------------------------------------
+        // SvfɃ[U[`̏Xg̏Ɏs
+        template< class Func >
+        void each(Func func) {
+            for (uint32_t idx = front_; idx != NONE; idx = links_[idx].next_) func(values_[idx]);
+        }
+
+        //-----------------------------------------------------------------------------------------------------
+        // \[g
+        // arg1... \[g̔rɎgplԂ_֐ ( vfɎ )
+        // tips... rl͗vf 1 x擾Al̗vf͌̏ۂ܂ ( \[g )
+        // tips... qς邾Ȃ̂Ńnh͂̂܂܎gpł܂
+        template< class GetCompValue >
+        void sortAscending(GetCompValue get_comp_value) {
+            using CompType = std::decay_t<decltype(get_comp_value(std::declval<const T&>()))>;
+            sort(get_comp_value, std::less<CompType>());
+        }
+        template< class GetCompValue >
+        void sortDescending(GetCompValue get_comp_value) {
+            using CompType = std::decay_t<decltype(get_comp_value(std::declval<const T&>()))>;
+            sort(get_comp_value, std::greater<CompType>());
+        }
+
+    private:
+        static constexpr uint32_t INDEX_BITS = 20;
+        static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+        static constexpr uint32_t GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+        static constexpr uint32_t NONE = INDEX_MASK;
+
+        struct Link {
+            uint32_t prev_ = NONE;
+            uint32_t next_ = NONE;			// gp͋󂫃Xbg̘A
+            uint32_t generation_ = 0;
+            bool is_used_ = false;
+        };
+
+        std::vector<T>		values_;
+        std::vector<Link>	links_;
+        uint32_t front_ = NONE;
+        uint32_t back_ = NONE;
+        uint32_t free_ = NONE;
+        uint32_t size_ = 0;
+
+        inline handle toHandle(const uint32_t idx) const noexcept {
+            return (idx == NONE) ? INVALID_HANDLE : (links_[idx].generation_ << INDEX_BITS) | idx;
+        }
+
+        template< class V >
+        uint32_t allocSlot(V&& value) {
+            uint32_t idx = free_;
+            if (idx != NONE) {
+                free_ = links_[idx].next_;
+                values_[idx] = std::forward<V>(value);
+            }
+            else {
+                idx = static_cast<uint32_t>(links_.size());
+                if (idx >= NONE) return NONE;
+                values_.emplace_back(std::forward<V>(value));
+                links_.emplace_back();
+            }
+            links_[idx].is_used_ = true;
+            ++size_;
+            return idx;
+        }
+
+        // before ̑Oɑ} ( NONE ȂŌ )
+        inline handle insert(const uint32_t before, const uint32_t idx) noexcept {
+            if (idx == NONE) return INVALID_HANDLE;
+            Link& link = links_[idx];
+            link.next_ = before;
+            link.prev_ = (before == NONE) ? back_ : links_[before].prev_;
+            if (link.prev_ != NONE) links_[link.prev_].next_ = idx;
+            else front_ = idx;
+            if (before != NONE) links_[before].prev_ = idx;
+            else back_ = idx;
+            return toHandle(idx);
+        }
+
+        template< class GetCompValue, class Compare >
+        void sort(GetCompValue& get_comp_value, Compare comp) {
+            using CompType = std::decay_t<decltype(get_comp_value(std::declval<const T&>()))>;
+            if (size_ < 2) return;
+            std::vector<CompType> keys;
+            std::vector<uint32_t> slots, order(size_), work(size_);
+            keys.reserve(size_);
+            slots.reserve(size_);
+            for (uint32_t idx = front_; idx != NONE; idx = links_[idx].next_) {
+                keys.emplace_back(get_comp_value(static_cast<const T&>(values_[idx])));
+                slots.emplace_back(idx);
+            }
+            for (uint32_t i = 0; i < size_; ++i) order[i] = i;
+            LinkLinearMergeSort(order.data(), work.data(), keys.data(), size_, comp);
+
+            uint32_t prev = NONE;
+            for (uint32_t i = 0; i < size_; ++i) {
+                uint32_t idx = slots[order[i]];
+                links_[idx].prev_ = prev;
+                if (prev != NONE) links_[prev].next_ = idx;
+                else front_ = idx;
+                prev = idx;
+            }
+            links_[prev].next_ = NONE;
+            back_ = prev;
+        }
+    };
+
+}
@@ -1,23 +1,28 @@
-#include <random>
+#include <cfloat>
 #include <numbers>
+#include <algorithm>
 #include "tnl_math.h"
+#include "tnl_rng.h"
 
 namespace tnl {
 
-    std::vector<double> Solve2(std::vector<double>& c) {
+    int Solve2(const double* c, double* s) noexcept {
         double p = c[1] / (2 * c[2]);
         double q = c[0] / c[2];
         double D = p * p - q;
         if (IsZeroD(D)) {
-            return {-p};
+            s[0] = -p;
+            return 1;
         }else if (D < 0) {
-            return {};
+            return 0;
         }else /* if (D > 0) */ {
             double sqrt_D = sqrt(D);
-            return { sqrt_D - p, -sqrt_D - p };
+            s[0] = sqrt_D - p;
+            s[1] = -sqrt_D - p;
+            return 2;
         }
     }
-    std::vector<double> Solve3(std::vector<double>& c) {
+    int Solve3(const double* c, double* s) noexcept {
         /* normal form: x^3 + Ax^2 + Bx + C = 0 */
         double A = c[2] / c[3];
         double B = c[1] / c[3];
@@ -34,37 +39,41 @@ namespace tnl {
         double cb_p = p * p * p;
         double D = q * q + cb_p;
 
-        std::vector<double> s ;
+        int num = 0;
 
         if (IsZeroD(D)) {
             if (IsZeroD(q)) /* one triple solution */ {
-                s = {0};
+                s[0] = 0;
+                num = 1;
             }else /* one single and one double solution */ {
                 double u = cbrt(-q);
-                s = { 2 * u, -u };
+                s[0] = 2 * u;
+                s[1] = -u;
+                num = 2;
             }
         }else if (D < 0) /* Casus irreducibilis: three real solutions */ {
             double phi = 1.0 / 3 * acos(-q / sqrt(-cb_p));
             double _stage_id = 2 * sqrt(-p);
-            s = { _stage_id * cos(phi),
-                -_stage_id * cos(phi + std::numbers::pi / 3),
-                -_stage_id * cos(phi - std::numbers::pi / 3) };
-
+            s[0] = _stage_id * cos(phi);
+            s[1] = -_stage_id * cos(phi + std::numbers::pi / 3);
+            s[2] = -_stage_id * cos(phi - std::numbers::pi / 3);
+            num = 3;
         }
         else /* one real solution */ {
             double sqrt_D = sqrt(D);
             double u = cbrt(sqrt_D - q);
             double v = -cbrt(sqrt_D + q);
-            s = { u + v };
+            s[0] = u + v;
+            num = 1;
         }
 
         /* resubstitute */
         double sub = 1.0 / 3 * A;
-        for (uint32_t i = 0; i < s.size(); ++i)
+        for (int i = 0; i < num; ++i)
             s[i] -= sub;
-        return s;
+        return num;
     }
-    std::vector<double> Solve4(std::vector<double>& c) {
+    int Solve4(const double* c, double* s) noexcept {
         /* normal form: x^4 + Ax^3 + Bx^2 + Cx + D = 0 */
         double A = c[3] / c[4];
         double B = c[2] / c[4];
@@ -77,25 +86,26 @@ namespace tnl {
         double p = -3.0 / 8 * sq_A + B;
         double q = 1.0 / 8 * sq_A * A - 1.0 / 2 * A * B + C;
         double r = -3.0 / 256 * sq_A * sq_A + 1.0 / 16 * sq_A * B - 1.0 / 4 * A * C + D;
-        std::vector<double> s ;
+        int num = 0;
 
         if (IsZeroD(r)) {
             /* no absolute term: y(y^3 + py + q) = 0 */
-            std::vector<double> coeffs = { q, p, 0, 1 };
-            s = Solve3(coeffs);
-            s.emplace_back(0);
+            const double coeffs[4] = { q, p, 0, 1 };
+            num = Solve3(coeffs, s);
+            s[num++] = 0;
         }
         else {
             /* solve the resolvent cubic ... */
-            std::vector<double> coeffs = {
+            const double cubic[4] = {
                 1.0 / 2 * r * p - 1.0 / 8 * q * q,
                     -r,
                     -1.0 / 2 * p,
                     1 };
-            s = Solve3(coeffs);
+            double cs[3];
+            Solve3(cubic, cs);
 
             /* ... and take the one real solution ... */
-            double z = s[0];
+            double z = cs[0];
 
             /* ... to build two quadric equations */
             double u = z * z - r;
@@ -106,46 +116,58 @@ namespace tnl {
             else if (u > 0)
                 u = sqrt(u);
             else
-                return {};
+                return 0;
 
             if (IsZeroD(v))
                 v = 0;
             else if (v > 0)
                 v = sqrt(v);
             else
-                return {};
+                return 0;
 
-            coeffs = {
+            const double quad0[3] = {
                 z - u,
                     q < 0 ? -v : v,
                     1 };
+            num = Solve2(quad0, s);
 
-            s = Solve2(coeffs);
-
-            coeffs = { z + u,
+            const double quad1[3] = { z + u,
                 q < 0 ? v : -v,
                 1 };
-            auto _stage_id = Solve2(coeffs);
-            s.insert(s.end(), _stage_id.begin(), _stage_id.end());
+            num += Solve2(quad1, s + num);
         }
 
         /* resubstitute */
         double sub = 1.0 / 4 * A;
-        for (uint32_t i = 0; i < s.size(); ++i)
+        for (int i = 0; i < num; ++i)
             s[i] -= sub;
 
-        return s;
+        return num;
+    }
+
+    std::vector<double> Solve2(std::vector<double>& c) {
+        double s[2];
+        int num = Solve2(c.data(), s);
+        return std::vector<double>(s, s + num);
+    }
+    std::vector<double> Solve3(std::vector<double>& c) {
+        double s[3];
+        int num = Solve3(c.data(), s);
+        return std::vector<double>(s, s + num);
+    }
+    std::vector<double> Solve4(std::vector<double>& c) {
+        double s[4];
+        int num = Solve4(c.data(), s);
+        return std::vector<double>(s, s + num);
     }
 
 
-    std::mt19937 g_mersenne ;
     void SetSeedMersenneTwister32(int seed) {
-        g_mersenne.seed(seed);
+        Rng::SetSeed(static_cast<uint64_t>(seed));
     }
 
     float GetRandomDistributionFloat(float min, float max) {
-        std::uniform_real_distribution<> param(static_cast<double>(min), static_cast<double>(max));
-        return static_cast<float>(param(g_mersenne));
+        return Rng::Thread().range(min, max);
     }
 
 
@@ -513,68 +535,135 @@ namespace tnl {
 
         int n = static_cast<int>(v.size()) - 1;
 
+        std::vector<tnl::Vector3> a;
+        std::vector<tnl::Vector3> b;
+        std::vector<tnl::Vector3> c;
+        std::vector<tnl::Vector3> d;
+        std::vector<tnl::Vector3> w;
+
         for (int i = 0; i <= n; ++i) {
-            a_.emplace_back(v[i]);
+            a.emplace_back(v[i]);
         }
 
         for (int i = 0; i <= n; ++i) {
             if (i == 0) {
-                c_.emplace_back(tnl::Vector3{ 0, 0, 0 });
+                c.emplace_back(tnl::Vector3{ 0, 0, 0 });
             }
             else if (i == n) {
-                c_.emplace_back(tnl::Vector3{ 0, 0, 0 });
+                c.emplace_back(tnl::Vector3{ 0, 0, 0 });
             }
             else {
-                c_.emplace_back(tnl::Vector3{
-                    3.0f * (a_[i - 1].x - 2.0f * a_[i].x + a_[i + 1].x),
-                    3.0f * (a_[i - 1].y - 2.0f * a_[i].y + a_[i + 1].y),
-                    3.0f * (a_[i - 1].z - 2.0f * a_[i].z + a_[i + 1].z)
+                c.emplace_back(tnl::Vector3{
+                    3.0f * (a[i - 1].x - 2.0f * a[i].x + a[i + 1].x),
+                    3.0f * (a[i - 1].y - 2.0f * a[i].y + a[i + 1].y),
+                    3.0f * (a[i - 1].z - 2.0f * a[i].z + a[i + 1].z)
                     });
             }
         }
 
         for (int i = 0; i < n; ++i) {
             if (i == 0) {
-                w_.emplace_back(tnl::Vector3{ 0, 0, 0 });
+                w.emplace_back(tnl::Vector3{ 0, 0, 0 });
             }
             else {
-                float x = 4.0f - w_[i - 1].x;
-                float y = 4.0f - w_[i - 1].y;
-                float z = 4.0f - w_[i - 1].z;
-                c_[i].x = (c_[i].x - c_[i - 1].x) / x;
-                c_[i].y = (c_[i].y - c_[i - 1].y) / y;
-                c_[i].z = (c_[i].z - c_[i - 1].z) / z;
-                w_.emplace_back(tnl::Vector3{ 1.0f / x, 1.0f / y, 1.0f / z });
+                float x = 4.0f - w[i - 1].x;
+                float y = 4.0f - w[i - 1].y;
+                float z = 4.0f - w[i - 1].z;
+                c[i].x = (c[i].x - c[i - 1].x) / x;
+                c[i].y = (c[i].y - c[i - 1].y) / y;
+                c[i].z = (c[i].z - c[i - 1].z) / z;
+                w.emplace_back(tnl::Vector3{ 1.0f / x, 1.0f / y, 1.0f / z });
             }
         }
 
         for (int i = (n - 1); i > 0; --i) {
-            c_[i] = c_[i] - c_[i + 1] * w_[i];
+            c[i] = c[i] - c[i + 1] * w[i];
         }
 
         for (int i = 0; i <= n; ++i) {
             if (i == n) {
-                d_.emplace_back(tnl::Vector3{ 0,0,0 });
-                b_.emplace_back(tnl::Vector3{ 0,0,0 });
+                d.emplace_back(tnl::Vector3{ 0,0,0 });
+                b.emplace_back(tnl::Vector3{ 0,0,0 });
             }
             else {
-                d_.emplace_back((c_[i + 1] - c_[i]) / 3.0f);
-                b_.emplace_back(a_[i + 1] - a_[i] - c_[i] - d_[i]);
+                d.emplace_back((c[i + 1] - c[i]) / 3.0f);
+                b.emplace_back(a[i + 1] - a[i] - c[i] - d[i]);
             }
         }
 
+        coeffs_.resize(a.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            coeffs_[i] = { a[i], b[i], c[i], d[i] };
+        }
+
+        // ʒe[u
+        if (n <= 0) return;
+        int arc_num = n * ARC_DIVISION;
+        arc_lengths_.resize(arc_num + 1);
+        arc_lengths_[0] = 0;
+        tnl::Vector3 prev = getPosition(0);
+        for (int i = 1; i <= arc_num; ++i) {
+            tnl::Vector3 now = getPosition(float(i) / float(arc_num));
+            arc_lengths_[i] = arc_lengths_[i - 1] + (now - prev).length();
+            prev = now;
+        }
+    }
+
+    // ret.... getPosition ̈
+    // arg2... TJnʒu ( TʂɍXV )
+    float CubicSpline::getArcParam(float length, int& arc_index) const noexcept {
+        int arc_num = static_cast<int>(arc_lengths_.size()) - 1;
+        int k = arc_index;
+        while (k < arc_num - 1 && arc_lengths_[k + 1] <= length) ++k;
+        arc_index = k;
+        float len = arc_lengths_[k + 1] - arc_lengths_[k];
+        float frac = (len > 0.0f) ? (length - arc_lengths_[k]) / len : 0.0f;
+        frac = std::clamp(frac, 0.0f, 1.0f);
+        return (float(k) + frac) / float(arc_num);
+    }
+
+    tnl::Vector3 CubicSpline::getPositionByLength(const float rate) const noexcept {
+        if (arc_lengths_.size() < 2) return coeffs_.empty() ? tnl::Vector3() : coeffs_[0].a_;
+        float length = std::clamp(rate, 0.0f, 1.0f) * arc_lengths_.back();
+        auto it = std::upper_bound(arc_lengths_.begin(), arc_lengths_.end(), length);
+        int k = static_cast<int>(it - arc_lengths_.begin()) - 1;
+        k = std::clamp(k, 0, static_cast<int>(arc_lengths_.size()) - 2);
+        return getPosition(getArcParam(length, k));
+    }
+
+    void CubicSpline::sample(const uint32_t num, tnl::Vector3* out) const noexcept {
+        if (num < 2) return;
+        for (uint32_t i = 0; i < num - 1; ++i) {
+            out[i] = getPosition(float(i) / float(num - 1));
+        }
+        out[num - 1] = coeffs_.back().a_;
+    }
+
+    void CubicSpline::sampleByLength(const uint32_t num, tnl::Vector3* out) const noexcept {
+        if (num < 2) return;
+        if (arc_lengths_.size() < 2) {
+            for (uint32_t i = 0; i < num; ++i) out[i] = coeffs_[0].a_;
+            return;
+        }
+        int k = 0;
+        for (uint32_t i = 0; i < num - 1; ++i) {
+            out[i] = getPosition(getArcParam(arc_lengths_.back() * (float(i) / float(num - 1)), k));
+        }
+        out[num - 1] = coeffs_.back().a_;
     }
 
 
     PointsLerp::PointsLerp(const std::vector< tnl::Vector3 >& points) {
         points_.resize(points.size());
         section_lengths_.resize(points.size());
+        directions_.resize(points.size());
         std::copy(points.begin(), points.end(), points_.begin());
 
         for (size_t i = 1; i < points_.size(); ++i) {
             section_lengths_[i] = (points_[i - 1] - points_[i]).length();
             all_length_ += section_lengths_[i];
             section_lengths_[i] += section_lengths_[i - 1];
+            directions_[i - 1] = tnl::Vector3::Normalize(points_[i] - points_[i - 1]);
         }
     }
     float PointsLerp::getLengthRate(float _stage_id) const noexcept {
@@ -589,13 +678,25 @@ namespace tnl {
         return section_lengths_[pn];
     }
 
+    // ݐϒ̔z񕪒T
     int PointsLerp::getPrevPoint(float _stage_id) const noexcept {
         float d = getLengthRate(_stage_id);
-        float c = 0.0f;
-        for (size_t i = 0; i < section_lengths_.size(); ++i) {
-            if (d >= section_lengths_[i]) continue;
-            return (int)(i - 1);
+        auto it = std::upper_bound(section_lengths_.begin(), section_lengths_.end(), d);
+        if (it == section_lengths_.end()) return 0;
+        return static_cast<int>(it - section_lengths_.begin()) - 1;
+    }
+
+    // Ԃ擪珇ɒH
+    void PointsLerp::sample(const uint32_t num, tnl::Vector3* out) const noexcept {
+        if (num < 2 || points_.empty()) return;
+        int last = static_cast<int>(points_.size()) - 1;
+        int n = 0;
+        for (uint32_t i = 0; i < num - 1; ++i) {
+            float d = all_length_ * (float(i) / float(num - 1));
+            while (n < last - 1 && d >= section_lengths_[n + 1]) ++n;
+            out[i] = points_[n] + (directions_[n] * (d - section_lengths_[n]));
         }
-        return 0;
+        out[num - 1] = points_[last];
     }
+
 }
\ No newline at end of file
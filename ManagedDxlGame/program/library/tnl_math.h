@@ -25,11 +25,14 @@ namespace tnl {
 	inline tnl::Vector3 ToMinAABB(const tnl::Vector3& pos, const tnl::Vector3& size) { return pos - (size * 0.5f); }
 
 	//----------------------------------------------------------------------------------------------
-	// ZkcCX^[V[hݒ
+	// V[hݒ
+	// tips... ݊p̊֐ł ł tnl::Rng::SetSeed Ăяo܂
 	void SetSeedMersenneTwister32(int seed);	
 	//----------------------------------------------------------------------------------------------
 	// ̎擾
 	// tips... ̊֐gpꍇ SetSeedMersenneTwister32 ŗV[hݒ肵Ă
+	//         ł tnl::Rng::Thread() gp̂ŃXbhɓƗnɂȂ܂
+	//         ʂɎ擾ꍇ tnl::Rng::fillFloat gpĂ
 	float GetRandomDistributionFloat(float min, float max);
 
 	//----------------------------------------------------------------------------------------------
@@ -192,6 +195,17 @@ namespace tnl {
 	std::vector<double> Solve3(std::vector<double>& c);
 	std::vector<double> Solve4(std::vector<double>& c);
 
+	//----------------------------------------------------------------------------------------------
+	// work... 2 ` 4 ̎ ( Œ蒷 )
+	// arg1... W ( c[ 0 ] + c[ 1 ]x + c[ 2 ]x^2 ... ̏  + 1  )
+	// arg2... ̎󂯎p ( ̗vf )
+	// ret.... ̌
+	// tips... std::vector łƓ𓯂ԂŕԂ܂
+	//         q[vgȂ̂Ŗt[ʂɌĂяo菈ł͂gpĂ
+	int Solve2(const double* c, double* s) noexcept;
+	int Solve3(const double* c, double* s) noexcept;
+	int Solve4(const double* c, double* s) noexcept;
+
 	//----------------------------------------------------------------------------------------------
 	// xWFXvC
 	// arg1... Ԏn_
@@ -208,11 +222,19 @@ namespace tnl {
 	//
 	class CubicSpline final {
 	private:
-		std::vector<tnl::Vector3> a_;
-		std::vector<tnl::Vector3> b_;
-		std::vector<tnl::Vector3> c_;
-		std::vector<tnl::Vector3> d_;
-		std::vector<tnl::Vector3> w_;
+		// Ԗ̌W ( 1 ԕAɔzu )
+		struct Coefficient {
+			tnl::Vector3 a_;
+			tnl::Vector3 b_;
+			tnl::Vector3 c_;
+			tnl::Vector3 d_;
+		};
+		// ʒe[u 1 Ԃ̕
+		static constexpr int ARC_DIVISION = 16;
+
+		std::vector<Coefficient> coeffs_;
+		std::vector<float> arc_lengths_;	// 擪̗ݐϒ ( Ԑ * ARC_DIVISION + 1  )
+		float getArcParam(float length, int& arc_index) const noexcept;
 
 	public:
 		CubicSpline() {};
@@ -222,13 +244,42 @@ namespace tnl {
 		// ԍW̎擾
 		// arg1... 0.0f ` 1.0f
 		// ret.... ԍW
-		inline tnl::Vector3 getPosition(float _stage_id) {
-			float rt = float(a_.size() - 1) * _stage_id;
+		// tips... ͒ʉߓ_̔ԍϓɊ蓖Ă̂Ȃ̂ŁAړx͋ԖɈقȂ܂
+		//         ̑xňړꍇ getPositionByLength gpĂ
+		inline tnl::Vector3 getPosition(float _stage_id) const noexcept {
+			float rt = float(coeffs_.size() - 1) * _stage_id;
 			int p = int(floor(rt));
 			float dt = rt - p;
-			return a_[p] + (b_[p] + (c_[p] + d_[p] * dt) * dt) * dt;
+			const Coefficient& k = coeffs_[p];
+			return k.a_ + (k.b_ + (k.c_ + k.d_ * dt) * dt) * dt;
 		}
 
+		//---------------------------------------------------------------------------
+		// Ȑ̒ɑ΂銄ŕԍW̎擾
+		// arg1... 0.0f ` 1.0f
+		// ret.... ԍW
+		// tips... \zɍ쐬ʒe[u񕪒T܂
+		tnl::Vector3 getPositionByLength(const float rate) const noexcept;
+
+		//---------------------------------------------------------------------------
+		// ԍẄꊇ擾
+		// arg1... 擾W ( 2 ȏ )
+		// arg2... W̎󂯎p ( arg1  )
+		// tips... n_I_܂ł getPosition ̈œW擾܂
+		void sample(const uint32_t num, tnl::Vector3* out) const noexcept;
+
+		//---------------------------------------------------------------------------
+		// ԍẄꊇ擾 ( Ԋu )
+		// arg1... 擾W ( 2 ȏ )
+		// arg2... W̎󂯎p ( arg1  )
+		// tips... n_I_܂łȐ̒œW擾܂
+		//         ʒe[u擪珇ɒĤ getPositionByLength JԂ荂ł
+		void sampleByLength(const uint32_t num, tnl::Vector3* out) const noexcept;
+
+		//---------------------------------------------------------------------------
+		// Ȑ̒ ( ʒe[uɂߎl )
+		inline float getLength() const noexcept { return arc_lengths_.empty() ? 0.0f : arc_lengths_.back(); }
+
 	};
 
 	//----------------------------------------------------------------------------------------------
@@ -239,6 +290,7 @@ namespace tnl {
 	private:
 		float all_length_ = 0;
 		std::vector< tnl::Vector3 > points_;
+		std::vector< tnl::Vector3 > directions_;	// eԂ̐Kςݕ
 		std::vector< float > section_lengths_;
 		float getLengthRate(float _stage_id) const noexcept;
 		float getLengthPoint(int pn) const noexcept;
@@ -252,13 +304,24 @@ namespace tnl {
 		// ԍW̎擾
 		// arg1... 0.0f ` 1.0f
 		// ret.... ԍW
-		inline tnl::Vector3 getPosition(const float _stage_id) {
+		inline tnl::Vector3 getPosition(const float _stage_id) const noexcept {
+			float len = getLengthRate(_stage_id);
 			int n = getPrevPoint(_stage_id);
-			float len = getLengthRate(_stage_id) - getLengthPoint(n);
-			tnl::Vector3 v = tnl::Vector3::Normalize((points_[n + 1] - points_[n]));
-			return points_[n] + (v * len);
+			return points_[n] + (directions_[n] * (len - getLengthPoint(n)));
 		}
 
+		//---------------------------------------------------------------------------
+		// ԍẄꊇ擾
+		// arg1... 擾W ( 2 ȏ )
+		// arg2... W̎󂯎p ( arg1  )
+		// tips... n_I_܂ł𓙊ԊuɕW擾܂ ( Ō̍W͏I_ )
+		//         Ԃ擪珇ɒĤ getPosition JԂ荂ł
+		void sample(const uint32_t num, tnl::Vector3* out) const noexcept;
+
+		//---------------------------------------------------------------------------
+		// S
+		inline float getLength() const noexcept { return all_length_; }
+
 	};
 
 }
\ No newline at end of file
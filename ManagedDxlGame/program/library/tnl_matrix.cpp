@@ -3,20 +3,148 @@
 
 namespace tnl {
 
-	using namespace DirectX;
-
 	void Matrix::rotationQuaternion(const tnl::Quaternion& q) noexcept {
-		DirectX::XMVECTOR v = DirectX::XMLoadFloat4(&q);
-		DirectX::XMMATRIX xm = DirectX::XMMatrixRotationQuaternion(v);
-		XMStoreFloat4x4(this, xm);
+		*this = RotationQuaternion(q);
 	}
 	Matrix Matrix::RotationQuaternion(const tnl::Quaternion& q) noexcept {
-		DirectX::XMVECTOR v = DirectX::XMLoadFloat4(&q);
-		DirectX::XMMATRIX xm = DirectX::XMMatrixRotationQuaternion(v);
-		DirectX::XMFLOAT4X4 f4x4;
-		XMStoreFloat4x4(&f4x4, xm);
-		return static_cast<Matrix>(f4x4);
+		float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+		float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+		float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+		return static_cast<Matrix>(Float4x4(
+			1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0,
+			2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0,
+			2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0,
+			0, 0, 0, 1));
+	}
+
+	// [(Z) -> sb`(X) -> [(Y) ̏ɉ]
+	Matrix Matrix::RotationPitchYawRoll(const float pitch, const float yaw, const float roll) noexcept {
+		float cp = cosf(pitch), sp = sinf(pitch);
+		float cy = cosf(yaw), sy = sinf(yaw);
+		float cr = cosf(roll), sr = sinf(roll);
+		return static_cast<Matrix>(Float4x4(
+			cr * cy + sr * sp * sy, sr * cp, sr * sp * cy - cr * sy, 0,
+			cr * sp * sy - sr * cy, cr * cp, sr * sy + cr * sp * cy, 0,
+			cp * sy, -sp, cp * cy, 0,
+			0, 0, 0, 1));
+	}
+
+	Matrix Matrix::RotationAxis(const Vector3& v, const float radian) noexcept {
+		Vector3 n = Vector3::Normalize(v);
+		float s = sinf(radian);
+		float c = cosf(radian);
+		float t = 1.0f - c;
+		return static_cast<Matrix>(Float4x4(
+			c + t * n.x * n.x, t * n.x * n.y + s * n.z, t * n.x * n.z - s * n.y, 0,
+			t * n.x * n.y - s * n.z, c + t * n.y * n.y, t * n.y * n.z + s * n.x, 0,
+			t * n.x * n.z + s * n.y, t * n.y * n.z - s * n.x, c + t * n.z * n.z, 0,
+			0, 0, 0, 1));
+	}
+
+	// ]qWJɂʋts
+	// tips... s񎮂 0 ̏ꍇ̌ʂ͕s ( XMMatrixInverse Ɠ )
+	Matrix Matrix::Inverse(const Matrix& m) noexcept {
+		const float* a = &m._11;
+		float inv[16];
+
+		inv[0] = a[5] * a[10] * a[15] - a[5] * a[11] * a[14] - a[9] * a[6] * a[15] + a[9] * a[7] * a[14] + a[13] * a[6] * a[11] - a[13] * a[7] * a[10];
+		inv[4] = -a[4] * a[10] * a[15] + a[4] * a[11] * a[14] + a[8] * a[6] * a[15] - a[8] * a[7] * a[14] - a[12] * a[6] * a[11] + a[12] * a[7] * a[10];
+		inv[8] = a[4] * a[9] * a[15] - a[4] * a[11] * a[13] - a[8] * a[5] * a[15] + a[8] * a[7] * a[13] + a[12] * a[5] * a[11] - a[12] * a[7] * a[9];
+		inv[12] = -a[4] * a[9] * a[14] + a[4] * a[10] * a[13] + a[8] * a[5] * a[14] - a[8] * a[6] * a[13] - a[12] * a[5] * a[10] + a[12] * a[6] * a[9];
+		inv[1] = -a[1] * a[10] * a[15] + a[1] * a[11] * a[14] + a[9] * a[2] * a[15] - a[9] * a[3] * a[14] - a[13] * a[2] * a[11] + a[13] * a[3] * a[10];
+		inv[5] = a[0] * a[10] * a[15] - a[0] * a[11] * a[14] - a[8] * a[2] * a[15] + a[8] * a[3] * a[14] + a[12] * a[2] * a[11] - a[12] * a[3] * a[10];
+		inv[9] = -a[0] * a[9] * a[15] + a[0] * a[11] * a[13] + a[8] * a[1] * a[15] - a[8] * a[3] * a[13] - a[12] * a[1] * a[11] + a[12] * a[3] * a[9];
+		inv[13] = a[0] * a[9] * a[14] - a[0] * a[10] * a[13] - a[8] * a[1] * a[14] + a[8] * a[2] * a[13] + a[12] * a[1] * a[10] - a[12] * a[2] * a[9];
+		inv[2] = a[1] * a[6] * a[15] - a[1] * a[7] * a[14] - a[5] * a[2] * a[15] + a[5] * a[3] * a[14] + a[13] * a[2] * a[7] - a[13] * a[3] * a[6];
+		inv[6] = -a[0] * a[6] * a[15] + a[0] * a[7] * a[14] + a[4] * a[2] * a[15] - a[4] * a[3] * a[14] - a[12] * a[2] * a[7] + a[12] * a[3] * a[6];
+		inv[10] = a[0] * a[5] * a[15] - a[0] * a[7] * a[13] - a[4] * a[1] * a[15] + a[4] * a[3] * a[13] + a[12] * a[1] * a[7] - a[12] * a[3] * a[5];
+		inv[14] = -a[0] * a[5] * a[14] + a[0] * a[6] * a[13] + a[4] * a[1] * a[14] - a[4] * a[2] * a[13] - a[12] * a[1] * a[6] + a[12] * a[2] * a[5];
+		inv[3] = -a[1] * a[6] * a[11] + a[1] * a[7] * a[10] + a[5] * a[2] * a[11] - a[5] * a[3] * a[10] - a[9] * a[2] * a[7] + a[9] * a[3] * a[6];
+		inv[7] = a[0] * a[6] * a[11] - a[0] * a[7] * a[10] - a[4] * a[2] * a[11] + a[4] * a[3] * a[10] + a[8] * a[2] * a[7] - a[8] * a[3] * a[6];
+		inv[11] = -a[0] * a[5] * a[11] + a[0] * a[7] * a[9] + a[4] * a[1] * a[11] - a[4] * a[3] * a[9] - a[8] * a[1] * a[7] + a[8] * a[3] * a[5];
+		inv[15] = a[0] * a[5] * a[10] - a[0] * a[6] * a[9] - a[4] * a[1] * a[10] + a[4] * a[2] * a[9] + a[8] * a[1] * a[6] - a[8] * a[2] * a[5];
+
+		float det = a[0] * inv[0] + a[1] * inv[4] + a[2] * inv[8] + a[3] * inv[12];
+		simd::vec4 rdet = simd::Splat(1.0f / det);
+
+		Matrix out;
+		for (int i = 0; i < 4; ++i) {
+			simd::Store4(out.m[i], simd::Mul(simd::Load4(&inv[i * 4]), rdet));
+		}
+		return out;
+	}
+
+	// 3x3 sxNg r0 r1 r2 ƂƋts̊e ( r1 x r2, r2 x r0, r0 x r1 ) / det
+	Matrix Matrix::InverseAffine(const Matrix& m) noexcept {
+		simd::vec4 r0 = simd::Load3(m.m[0]);
+		simd::vec4 r1 = simd::Load3(m.m[1]);
+		simd::vec4 r2 = simd::Load3(m.m[2]);
+		simd::vec4 t = simd::Load3(m.m[3]);
+
+		simd::vec4 c0 = simd::Cross3(r1, r2);
+		simd::vec4 c1 = simd::Cross3(r2, r0);
+		simd::vec4 c2 = simd::Cross3(r0, r1);
+		simd::vec4 rdet = simd::Splat(1.0f / simd::Dot3(r0, c0));
+		c0 = simd::Mul(c0, rdet);
+		c1 = simd::Mul(c1, rdet);
+		c2 = simd::Mul(c2, rdet);
+
+		simd::mat4 inv = { {
+			c0, c1, c2, simd::Set(0, 0, 0, 1)
+		} };
+		inv = simd::Transpose(inv);
+		inv.r[3] = simd::Set(-simd::Dot3(t, c0), -simd::Dot3(t, c1), -simd::Dot3(t, c2), 1.0f);
+		return Matrix(inv);
+	}
+
+	Matrix Matrix::InverseOrthonormal(const Matrix& m) noexcept {
+		simd::vec4 r0 = simd::Load3(m.m[0]);
+		simd::vec4 r1 = simd::Load3(m.m[1]);
+		simd::vec4 r2 = simd::Load3(m.m[2]);
+		simd::vec4 t = simd::Load3(m.m[3]);
+
+		simd::mat4 inv = { {
+			r0, r1, r2, simd::Set(0, 0, 0, 1)
+		} };
+		inv = simd::Transpose(inv);
+		inv.r[3] = simd::Set(-simd::Dot3(t, r0), -simd::Dot3(t, r1), -simd::Dot3(t, r2), 1.0f);
+		return Matrix(inv);
+	}
+
+	Matrix Matrix::LookAtLH(const Vector3& eye, const Vector3& look, const Vector3& vup) noexcept {
+		simd::vec4 e = simd::Load3(eye);
+		simd::vec4 r2 = simd::Normalize3(simd::Sub(simd::Load3(look), e));
+		simd::vec4 r0 = simd::Normalize3(simd::Cross3(simd::Load3(vup), r2));
+		simd::vec4 r1 = simd::Cross3(r2, r0);
+		simd::vec4 ne = simd::Neg(e);
+		simd::mat4 m = { {
+			simd::Set(simd::GetX(r0), simd::GetY(r0), simd::GetZ(r0), simd::Dot3(r0, ne)),
+			simd::Set(simd::GetX(r1), simd::GetY(r1), simd::GetZ(r1), simd::Dot3(r1, ne)),
+			simd::Set(simd::GetX(r2), simd::GetY(r2), simd::GetZ(r2), simd::Dot3(r2, ne)),
+			simd::Set(0, 0, 0, 1)
+		} };
+		return Matrix(simd::Transpose(m));
+	}
+
+	Matrix Matrix::PerspectiveFovLH(const float angle, const float aspect, const float near_z, const float far_z) noexcept {
+		float h = cosf(angle * 0.5f) / sinf(angle * 0.5f);
+		float w = h / aspect;
+		float range = far_z / (far_z - near_z);
+		return static_cast<Matrix>(Float4x4(
+			w, 0, 0, 0,
+			0, h, 0, 0,
+			0, 0, range, 1,
+			0, 0, -range * near_z, 0));
+	}
+
+	Matrix Matrix::OrthoLH(const float width, const float height, const float near_z, const float far_z) noexcept {
+		float range = 1.0f / (far_z - near_z);
+		return static_cast<Matrix>(Float4x4(
+			2.0f / width, 0, 0, 0,
+			0, 2.0f / height, 0, 0,
+			0, 0, range, 0,
+			0, 0, -range * near_z, 1));
 	}
 
 
-}
\ No newline at end of file
+}
@@ -1,95 +1,81 @@
 #pragma once
-#include <DirectXMath.h>
+#include "tnl_simd.h"
 #include "tnl_vector.h"
 
 namespace tnl{
 
 	class Quaternion;
-	class Matrix final : public DirectX::XMFLOAT4X4 {
+	class Matrix final : public Float4x4 {
 	public:
 		Matrix() noexcept :
-			XMFLOAT4X4(
+			Float4x4(
 				1,0,0,0,
 				0,1,0,0,
 				0,0,1,0,
 				0,0,0,1)
 		{}
-		explicit Matrix(DirectX::XMMATRIX& m) noexcept { DirectX::XMStoreFloat4x4(this, m); }
-		explicit Matrix(DirectX::XMFLOAT4X4& m) noexcept : DirectX::XMFLOAT4X4(m) {}
+		explicit Matrix(const simd::mat4& m) noexcept { simd::StoreMatrix(*this, m); }
+		explicit Matrix(const Float4x4& m) noexcept : Float4x4(m) {}
 
 
 		//-----------------------------------------------------------------------------------------------------
 		//
 		// operator
 		//
-		Matrix& operator = (DirectX::XMMATRIX& other) noexcept;
+		Matrix& operator = (const simd::mat4& other) noexcept;
 		Matrix operator * (const Matrix& other) const noexcept;
 		Matrix& operator *= (const Matrix& other) noexcept;
 
-	
+
 		//-----------------------------------------------------------------------------------------------------
 		//
 		// inline function
 		//
 		inline void translation( const float x, const float y, const float z ) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixTranslation(x, y, z);
-			XMStoreFloat4x4(this, xm);
+			*this = Translation(x, y, z);
 		}
 		inline void scaling( const float x, const float y, const float z ) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixScaling(x, y, z);
-			XMStoreFloat4x4(this, xm);
+			*this = Scaling(x, y, z);
 		}
 		inline void rotationX(const float radian) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixRotationX(radian);
-			XMStoreFloat4x4(this, xm);
+			*this = RotationX(radian);
 		}
 		inline void rotationY(const float radian) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixRotationY(radian);
-			XMStoreFloat4x4(this, xm);
+			*this = RotationY(radian);
 		}
 		inline void rotationZ(const float radian) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixRotationZ(radian);
-			XMStoreFloat4x4(this, xm);
+			*this = RotationZ(radian);
 		}
 		inline void rotationPitchYawRoll(const float pitch, const float yaw, const float roll) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixRotationRollPitchYaw(pitch, yaw, roll);
-			XMStoreFloat4x4(this, xm);
+			*this = RotationPitchYawRoll(pitch, yaw, roll);
 		}
 		inline void rotationAxis( Vector3 &v, const float radian) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixRotationAxis(DirectX::XMLoadFloat3(&v), radian);
-			XMStoreFloat4x4(this, xm);
+			*this = RotationAxis(v, radian);
 		}
 		inline void inverse() noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixInverse(nullptr, DirectX::XMLoadFloat4x4( this ));
-			XMStoreFloat4x4(this, xm);
+			*this = Inverse(*this);
 		}
 		inline void transpose() noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixTranspose(DirectX::XMLoadFloat4x4(this));
-			XMStoreFloat4x4(this, xm);
+			*this = Transpose(*this);
 		}
 
 		inline void lookAtLH(const Vector3& eye, const Vector3& look, const Vector3& vup) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixLookAtLH(
-				DirectX::XMLoadFloat3(&eye),
-				DirectX::XMLoadFloat3(&look),
-				DirectX::XMLoadFloat3(&vup));
-			XMStoreFloat4x4(this, xm);
+			*this = LookAtLH(eye, look, vup);
 		}
 
 		inline Matrix perspectiveFovLH(const float angle, const float aspect, const float near_z, const float far_z) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixPerspectiveFovLH(angle, aspect, near_z, far_z);
-			XMStoreFloat4x4(this, xm);
+			*this = PerspectiveFovLH(angle, aspect, near_z, far_z);
+			return *this;
 		}
 
 		inline Matrix orthoLH(const float width, const float height, const float near_z, const float far_z) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixOrthographicLH(width, height, near_z, far_z);
-			XMStoreFloat4x4(this, xm);
+			*this = OrthoLH(width, height, near_z, far_z);
+			return *this;
 		}
 
 		inline Matrix billboard(const Vector3& eye, const Vector3& look, const Vector3& vup) noexcept {
-			*this = LookAtLH(eye, look, vup);
-			this->inverse();
-			_41 = _42 = _43 = 0;
+			*this = Billboard(eye, look, vup);
+			return *this;
 		}
 
 		inline std::string toString(const std::string& format = "%f") {
@@ -108,102 +94,65 @@ namespace tnl{
 		// static inline function
 		//
 		static inline Matrix Translation(const float x, const float y, const float z) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixTranslation(x, y, z);
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);			
-			return static_cast<Matrix>(f4x4);
+			return static_cast<Matrix>(Float4x4(
+				1, 0, 0, 0,
+				0, 1, 0, 0,
+				0, 0, 1, 0,
+				x, y, z, 1));
 		}
 		static inline Matrix Translation(const tnl::Vector3& v) noexcept {
 			return Translation(v.x, v.y, v.z);
 		}
 
 		static inline Matrix Scaling(const float x, const float y, const float z) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixScaling(x, y, z);
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);
-			return static_cast<Matrix>(f4x4);
+			return static_cast<Matrix>(Float4x4(
+				x, 0, 0, 0,
+				0, y, 0, 0,
+				0, 0, z, 0,
+				0, 0, 0, 1));
 		}
 		static inline Matrix Scaling(const tnl::Vector3& v) noexcept {
 			return Scaling(v.x, v.y, v.z);
 		}
 		static inline Matrix RotationX(const float radian) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixRotationX(radian);
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);
-			return static_cast<Matrix>(f4x4);
+			float s = sinf(radian);
+			float c = cosf(radian);
+			return static_cast<Matrix>(Float4x4(
+				1,  0, 0, 0,
+				0,  c, s, 0,
+				0, -s, c, 0,
+				0,  0, 0, 1));
 		}
 		static inline Matrix RotationY(const float radian) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixRotationY(radian);
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);
-			return static_cast<Matrix>(f4x4);
+			float s = sinf(radian);
+			float c = cosf(radian);
+			return static_cast<Matrix>(Float4x4(
+				c, 0, -s, 0,
+				0, 1,  0, 0,
+				s, 0,  c, 0,
+				0, 0,  0, 1));
 		}
 		static inline Matrix RotationZ(const float radian) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixRotationZ(radian);
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);
-			return static_cast<Matrix>(f4x4);
-		}
-		static inline Matrix RotationPitchYawRoll( const float pitch, const float yaw, const float roll ) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixRotationRollPitchYaw(pitch, yaw, roll);
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);
-			return static_cast<Matrix>(f4x4);
+			float s = sinf(radian);
+			float c = cosf(radian);
+			return static_cast<Matrix>(Float4x4(
+				 c, s, 0, 0,
+				-s, c, 0, 0,
+				 0, 0, 1, 0,
+				 0, 0, 0, 1));
 		}
 		static inline Matrix RotationPitchYawRoll(const Vector3& rot) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixRotationRollPitchYaw(rot.x, rot.y, rot.z);
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);
-			return static_cast<Matrix>(f4x4);
-		}
-		static inline Matrix RotationAxis(const Vector3& v, const float radian) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixRotationAxis(DirectX::XMLoadFloat3(&v), radian);
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);
-			return static_cast<Matrix>(f4x4);
-		}
-		static inline Matrix Inverse(const Matrix& m) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixInverse(nullptr, DirectX::XMLoadFloat4x4(&m));
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);
-			return static_cast<Matrix>(f4x4);
+			return RotationPitchYawRoll(rot.x, rot.y, rot.z);
 		}
 		static inline Matrix Transpose(const Matrix& m) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixTranspose(DirectX::XMLoadFloat4x4(&m));
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);
-			return static_cast<Matrix>(f4x4);
-		}
-
-		static inline Matrix LookAtLH(const Vector3& eye, const Vector3& look, const Vector3& vup) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixLookAtLH(
-				DirectX::XMLoadFloat3(&eye),
-				DirectX::XMLoadFloat3(&look),
-				DirectX::XMLoadFloat3(&vup));
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);
-			return static_cast<Matrix>(f4x4);
-		}
-
-		static inline Matrix PerspectiveFovLH(const float angle, const float aspect, const float near_z, const float far_z) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixPerspectiveFovLH(angle, aspect, near_z, far_z);
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);
-			return static_cast<Matrix>(f4x4);
-		}
-
-		static inline Matrix OrthoLH( const float width, const float height, const float near_z, const float far_z ) noexcept {
-			DirectX::XMMATRIX xm = DirectX::XMMatrixOrthographicLH(width, height, near_z, far_z);
-			DirectX::XMFLOAT4X4 f4x4;
-			XMStoreFloat4x4(&f4x4, xm);
-			return static_cast<Matrix>(f4x4);
+			return Matrix(simd::Transpose(simd::LoadMatrix(m)));
 		}
 
+		// tips... LookAtLH ̉]͐KȂ̂ŋts͓]uŋ܂
 		static inline Matrix Billboard(const Vector3& eye, const Vector3& look, const Vector3& vup) noexcept {
 			Matrix m = LookAtLH(eye, look, vup);
-			m.inverse();
 			m._41 = m._42 = m._43 = 0;
-			return m;
+			return Transpose(m);
 		}
 
 
@@ -218,22 +167,37 @@ namespace tnl{
 		// static function
 		//
 		static Matrix RotationQuaternion(const tnl::Quaternion& q) noexcept;
+		static Matrix RotationPitchYawRoll(const float pitch, const float yaw, const float roll) noexcept;
+		static Matrix RotationAxis(const Vector3& v, const float radian) noexcept;
+		static Matrix Inverse(const Matrix& m) noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// AtBϊs̋ts
+		// arg1... 4 ڂ ( 0, 0, 0, 1 ) ̍s ( XP[E]Esړ̍ )
+		// tips... 3x3 ̋tsƕsړ̋tϊ݂̂ŌvẐ Inverse 荂ł
+		//         4 ڂ ( 0, 0, 0, 1 ) łȂs ( ˉes ) ɂ͎gpł܂
+		static Matrix InverseAffine(const Matrix& m) noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// ]ƕsړ݂̂̍s̋ts
+		// arg1... 3x3 Kȍs ( r[sEXP[܂܂Ȃ[hs )
+		// tips... 3x3 ]u邾ŋ܂̂ōłł
+		//         XP[܂ލsɂ InverseAffine gpĂ
+		static Matrix InverseOrthonormal(const Matrix& m) noexcept;
+		static Matrix LookAtLH(const Vector3& eye, const Vector3& look, const Vector3& vup) noexcept;
+		static Matrix PerspectiveFovLH(const float angle, const float aspect, const float near_z, const float far_z) noexcept;
+		static Matrix OrthoLH(const float width, const float height, const float near_z, const float far_z) noexcept;
 
 	};
 
 
-	inline Matrix& Matrix::operator = (DirectX::XMMATRIX& other) noexcept {
-		DirectX::XMStoreFloat4x4(this, other);
+	inline Matrix& Matrix::operator = (const simd::mat4& other) noexcept {
+		simd::StoreMatrix(*this, other);
 		return *this;
 	}
 
 	inline Matrix Matrix::operator * (const Matrix& other) const noexcept {
-		DirectX::XMMATRIX xm1 = DirectX::XMLoadFloat4x4(this);
-		DirectX::XMMATRIX xm2 = DirectX::XMLoadFloat4x4(&other);
-		DirectX::XMMATRIX xm3 = DirectX::XMMatrixMultiply(xm1, xm2);
-		DirectX::XMFLOAT4X4 f4x4;
-		DirectX::XMStoreFloat4x4(&f4x4, xm3);
-		return static_cast<Matrix>(f4x4);
+		return Matrix(simd::Multiply(simd::LoadMatrix(*this), simd::LoadMatrix(other)));
 	}
 
 	inline Matrix& Matrix::operator *= (const Matrix& other) noexcept {
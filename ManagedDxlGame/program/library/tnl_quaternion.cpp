@@ -1,4 +1,5 @@
 #include <math.h>
+#include <cfloat>
 #include "tnl_util.h"
 #include "tnl_math.h"
 #include "tnl_vector.h"
@@ -6,30 +7,27 @@
 
 namespace tnl {
 
-	using namespace DirectX;
-
-
 	Quaternion Quaternion::RotationAxis(const Vector3& axis, const float rotate) noexcept {
-		XMFLOAT4 f4;		
-		XMStoreFloat4( &f4, XMQuaternionRotationAxis(XMLoadFloat3(&axis), rotate) );
-		return static_cast<Quaternion>(f4);
+		simd::vec4 n = simd::Normalize3(simd::Load3(axis));
+		simd::vec4 q = simd::Scale(n, sinf(rotate * 0.5f));
+		return Quaternion(simd::GetX(q), simd::GetY(q), simd::GetZ(q), cosf(rotate * 0.5f));
 	}
 	Quaternion Quaternion::RotationRollPitchYawFromVector(const Vector3& angles) noexcept {
-		XMFLOAT4 f4;
-		XMStoreFloat4(&f4, XMQuaternionRotationRollPitchYawFromVector( XMLoadFloat3(&angles) ) );
-		return static_cast<Quaternion>(f4);
+		float cp = cosf(angles.x * 0.5f), sp = sinf(angles.x * 0.5f);
+		float cy = cosf(angles.y * 0.5f), sy = sinf(angles.y * 0.5f);
+		float cr = cosf(angles.z * 0.5f), sr = sinf(angles.z * 0.5f);
+		return Quaternion(
+			sp * cy * cr + cp * sy * sr,
+			cp * sy * cr - sp * cy * sr,
+			cp * cy * sr - sp * sy * cr,
+			cp * cy * cr + sp * sy * sr);
 	}
 
 	Quaternion Quaternion::Subtract(const Quaternion& q1, const Quaternion& q2) noexcept {
-		DirectX::XMVECTOR q0i = DirectX::XMQuaternionInverse(DirectX::XMLoadFloat4(&q1));
-		DirectX::XMVECTOR qd = DirectX::XMQuaternionMultiply(q0i, DirectX::XMLoadFloat4(&q2));
-		if (qd.m128_f32[3] < 0) {
-			qd.m128_f32[0] *= -1.0f;
-			qd.m128_f32[1] *= -1.0f;
-			qd.m128_f32[2] *= -1.0f;
-			qd.m128_f32[3] *= -1.0f;
-		}
-		return static_cast<Quaternion>(qd);
+		simd::vec4 q0i = simd::QuaternionInverse(simd::Load4(q1));
+		simd::vec4 qd = simd::QuaternionMultiply(q0i, simd::Load4(q2));
+		if (simd::GetW(qd) < 0) qd = simd::Neg(qd);
+		return Quaternion(qd);
 	}
 
 	Vector3 Quaternion::getEuler() const noexcept {
@@ -93,17 +91,62 @@ namespace tnl {
 	}
 
 	void Quaternion::slerp(const Quaternion& q, const float _stage_id) {
-		DirectX::XMStoreFloat4(this, DirectX::XMQuaternionSlerp(DirectX::XMLoadFloat4(this), DirectX::XMLoadFloat4(&q), _stage_id));
+		simd::vec4 q0 = simd::Load4(*this);
+		simd::vec4 q1 = simd::Load4(q);
+		float cos_omega = simd::Dot4(q0, q1);
+		float sign = 1.0f;
+		if (cos_omega < 0.0f) {
+			cos_omega = -cos_omega;
+			sign = -1.0f;
+		}
+		float s0, s1;
+		if (cos_omega < 1.0f - 0.00001f) {
+			float sin_omega = sqrtf(1.0f - cos_omega * cos_omega);
+			float omega = atan2f(sin_omega, cos_omega);
+			s0 = sinf((1.0f - _stage_id) * omega) / sin_omega;
+			s1 = sinf(_stage_id * omega) / sin_omega;
+		}
+		else {
+			s0 = 1.0f - _stage_id;
+			s1 = _stage_id;
+		}
+		simd::Store4(*this, simd::MulAdd(q1, simd::Splat(s1 * sign), simd::Scale(q0, s0)));
 	}
 
 	Quaternion Quaternion::LookAt(const Vector3& eye, const Vector3& look, const Vector3& vup) {
-		DirectX::XMMATRIX xm = DirectX::XMMatrixLookAtLH(
-			DirectX::XMLoadFloat3(&eye),
-			DirectX::XMLoadFloat3(&look),
-			DirectX::XMLoadFloat3(&vup));
-		DirectX::XMMATRIX inv = DirectX::XMMatrixInverse(nullptr, xm);
-		XMVECTOR q = XMQuaternionRotationMatrix(inv);
-		return static_cast<Quaternion>(q);
+		Matrix m = Matrix::InverseOrthonormal(Matrix::LookAtLH(eye, look, vup));
+
+		// ]s񂩂NH[^jIւ̕ϊ
+		Quaternion q;
+		if (m._33 <= 0.0f) {
+			float dif10 = m._22 - m._11;
+			float omr22 = 1.0f - m._33;
+			if (dif10 <= 0.0f) {
+				float four_x_sqr = omr22 - dif10;
+				float inv4x = 0.5f / sqrtf(four_x_sqr);
+				q = Quaternion(four_x_sqr * inv4x, (m._12 + m._21) * inv4x, (m._13 + m._31) * inv4x, (m._23 - m._32) * inv4x);
+			}
+			else {
+				float four_y_sqr = omr22 + dif10;
+				float inv4y = 0.5f / sqrtf(four_y_sqr);
+				q = Quaternion((m._12 + m._21) * inv4y, four_y_sqr * inv4y, (m._23 + m._32) * inv4y, (m._31 - m._13) * inv4y);
+			}
+		}
+		else {
+			float sum10 = m._22 + m._11;
+			float opr22 = 1.0f + m._33;
+			if (sum10 <= 0.0f) {
+				float four_z_sqr = opr22 - sum10;
+				float inv4z = 0.5f / sqrtf(four_z_sqr);
+				q = Quaternion((m._13 + m._31) * inv4z, (m._23 + m._32) * inv4z, four_z_sqr * inv4z, (m._12 - m._21) * inv4z);
+			}
+			else {
+				float four_w_sqr = opr22 + sum10;
+				float inv4w = 0.5f / sqrtf(four_w_sqr);
+				q = Quaternion((m._23 - m._32) * inv4w, (m._31 - m._13) * inv4w, (m._12 - m._21) * inv4w, four_w_sqr * inv4w);
+			}
+		}
+		return q;
 	}
 
 	Quaternion Quaternion::LookAtAxisY(const Vector3& eye, const Vector3& look) {
@@ -1,21 +1,21 @@
 #pragma once
-#include <DirectXMath.h>
+#include "tnl_simd.h"
 #include "tnl_matrix.h"
 namespace tnl {
 	class Vector3;
 	class Matrix;
-	class Quaternion final : public DirectX::XMFLOAT4 {
+	class Quaternion final : public Float4 {
 	public:
-		Quaternion() noexcept : DirectX::XMFLOAT4(0, 0, 0, 1) {}
-		Quaternion(const float xx, const float yy, const float zz, const float ww) noexcept : DirectX::XMFLOAT4(xx, yy, zz, ww) {}
-		explicit Quaternion(DirectX::XMVECTOR& v) noexcept { DirectX::XMStoreFloat4(this, v); }
-		explicit Quaternion(DirectX::XMFLOAT4& v) noexcept { this->x = v.x; this->y = v.y; this->z = v.z; this->w = v.w; }
+		Quaternion() noexcept : Float4(0, 0, 0, 1) {}
+		Quaternion(const float xx, const float yy, const float zz, const float ww) noexcept : Float4(xx, yy, zz, ww) {}
+		explicit Quaternion(const simd::vec4& v) noexcept { simd::Store4(*this, v); }
+		explicit Quaternion(const Float4& v) noexcept { this->x = v.x; this->y = v.y; this->z = v.z; this->w = v.w; }
 
 		//-----------------------------------------------------------------------------------------------------
 		//
 		// operator
 		//
-		const Quaternion& operator = (DirectX::XMVECTOR& other) noexcept;
+		const Quaternion& operator = (const simd::vec4& other) noexcept;
 		const Quaternion operator * (const Quaternion& other) const noexcept;
 		const Quaternion& operator *= (const Quaternion& other) noexcept;
 
@@ -24,9 +24,7 @@ namespace tnl {
 		// inline function
 		//
 		inline Matrix getMatrix() const noexcept {
-			DirectX::XMFLOAT4X4 m4x4;
-			DirectX::XMStoreFloat4x4(&m4x4, DirectX::XMMatrixRotationQuaternion(DirectX::XMLoadFloat4(this)));
-			return static_cast<Matrix>(m4x4);
+			return Matrix::RotationQuaternion(*this);
 		}
 
 		//-----------------------------------------------------------------------------------------------------
@@ -51,18 +49,13 @@ namespace tnl {
 
 
 	//-----------------------------------------------------------------------------------------------------
-	inline const Quaternion& Quaternion::operator = (DirectX::XMVECTOR& other) noexcept {
-		DirectX::XMStoreFloat4(this, other);
+	inline const Quaternion& Quaternion::operator = (const simd::vec4& other) noexcept {
+		simd::Store4(*this, other);
 		return *this;
 	}
 	//-----------------------------------------------------------------------------------------------------
 	inline const Quaternion Quaternion::operator * (const Quaternion& other) const noexcept {
-		DirectX::XMVECTOR l = DirectX::XMLoadFloat4(this);
-		DirectX::XMVECTOR r = DirectX::XMLoadFloat4(&other);
-		DirectX::XMVECTOR v = DirectX::XMQuaternionMultiply(l, r);
-		DirectX::XMFLOAT4 f4;
-		DirectX::XMStoreFloat4(&f4, v);
-		return static_cast<Quaternion>(f4);
+		return Quaternion(simd::QuaternionMultiply(simd::Load4(*this), simd::Load4(other)));
 	}
 	//-----------------------------------------------------------------------------------------------------
 	inline const Quaternion& Quaternion::operator *= (const Quaternion& other) noexcept {
@@ -0,0 +1,90 @@
+#include <atomic>
+#include "tnl_rng.h"
+
+namespace tnl {
+
+	namespace {
+		std::atomic<uint64_t> g_thread_seed{ 0 };
+		std::atomic<uint32_t> g_thread_stream{ 0 };
+
+		inline uint64_t SplitMix64(uint64_t& x) noexcept {
+			uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+			return z ^ (z >> 31);
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Rng::seed(const uint64_t seed_value) noexcept {
+		uint64_t x = seed_value;
+		for (int i = 0; i < 4; ++i) s_[i] = SplitMix64(x);
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Rng::jump() noexcept {
+		static constexpr uint64_t JUMP[] = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+		uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+		for (int i = 0; i < 4; ++i) {
+			for (int b = 0; b < 64; ++b) {
+				if (JUMP[i] & (1ULL << b)) {
+					s0 ^= s_[0];
+					s1 ^= s_[1];
+					s2 ^= s_[2];
+					s3 ^= s_[3];
+				}
+				next();
+			}
+		}
+		s_[0] = s0;
+		s_[1] = s1;
+		s_[2] = s2;
+		s_[3] = s3;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	//  32 bit Ɣ͈͂̐ς̏ʂʂƂA΂肪o鉺ʂ̒l݈̂ ( Lemire ̕@ )
+	int Rng::range(const int min_value, const int max_value) noexcept {
+		uint32_t r = static_cast<uint32_t>(max_value) - static_cast<uint32_t>(min_value) + 1;
+		if (0 == r) return static_cast<int>(next() >> 32);
+		uint64_t m = (next() >> 32) * r;
+		uint32_t l = static_cast<uint32_t>(m);
+		if (l < r) {
+			uint32_t t = (0u - r) % r;
+			while (l < t) {
+				m = (next() >> 32) * r;
+				l = static_cast<uint32_t>(m);
+			}
+		}
+		return static_cast<int>(static_cast<uint32_t>(min_value) + static_cast<uint32_t>(m >> 32));
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Rng::fillFloat(float* out, const uint32_t num, const float min_value, const float max_value) noexcept {
+		for (uint32_t i = 0; i < num; ++i) {
+			out[i] = range(min_value, max_value);
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	Rng& Rng::Thread() noexcept {
+		thread_local Rng rng = [] {
+			Rng r(g_thread_seed.load());
+			uint32_t stream = g_thread_stream.fetch_add(1);
+			for (uint32_t i = 0; i < stream; ++i) r.jump();
+			return r;
+		}();
+		return rng;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Rng::SetSeed(const uint64_t seed_value) noexcept {
+		//  Thread() ͌nԍ擾̂ŁAԍ߂ɌĂł
+		Rng& rng = Thread();
+		g_thread_seed.store(seed_value);
+		rng.seed(seed_value);
+		// ĂяoXbhn 0 ƂAȍ~ɐXbh͏Ɠ 1, 2, ... g
+		g_thread_stream.store(1);
+	}
+
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include <cstdint>
+
+namespace tnl {
+
+	//----------------------------------------------------------------------------------------------
+	//
+	//  ( xoshiro256** )
+	//
+	// tips... Ԃ 32 byte  std::mt19937 (  2.5KB ) 菬ł
+	//         std::shuffle  std::uniform_int_distribution ̕WCuɂ̂܂ܓn܂
+	//
+	//         Rng::Thread() ŃXbhɓƗn̐擾ł܂
+	//         eXbȟn Rng::SetSeed Őݒ肵V[h jump  2^128 炵̂ł
+	//
+	//         ogȂǍČKvȏʂł
+	//         V[hw肵Đ Rng 񂷂 Rng::Thread().seed( seed ) Őݒ肵Ă
+	//
+	class Rng final {
+	public:
+		using result_type = uint64_t;
+
+		explicit Rng(const uint64_t seed_value = 0) noexcept { seed(seed_value); }
+
+		//-----------------------------------------------------------------------------------------------------
+		// V[hݒ
+		// tips... splitmix64  256 bit ̏ԂɓWJ܂
+		void seed(const uint64_t seed_value) noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// 2^128  next ĂяôƓԂɐi߂
+		// tips... V[hƗnꍇɎgp܂
+		void jump() noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// 64 bit 
+		inline uint64_t next() noexcept {
+			const uint64_t result = Rotl(s_[1] * 5, 7) * 9;
+			const uint64_t t = s_[1] << 17;
+			s_[2] ^= s_[0];
+			s_[3] ^= s_[1];
+			s_[1] ^= s_[2];
+			s_[0] ^= s_[3];
+			s_[2] ^= t;
+			s_[3] = Rotl(s_[3], 45);
+			return result;
+		}
+		inline result_type operator()() noexcept { return next(); }
+		static constexpr result_type min() noexcept { return 0; }
+		static constexpr result_type max() noexcept { return UINT64_MAX; }
+
+		//-----------------------------------------------------------------------------------------------------
+		//  0.0f ȏ 1.0f 
+		inline float nextFloat() noexcept { return static_cast<float>(next() >> 40) * (1.0f / 16777216.0f); }
+
+		//-----------------------------------------------------------------------------------------------------
+		//  min ȏ max 
+		inline float range(const float min_value, const float max_value) noexcept {
+			return min_value + (max_value - min_value) * nextFloat();
+		}
+
+		//-----------------------------------------------------------------------------------------------------
+		//  min ȏ max ȉ
+		// tips... ΂̂Ȃlzł
+		int range(const int min_value, const int max_value) noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// ̈ꊇ擾
+		// arg1... 󂯎pz
+		// arg2... vf
+		// arg3... ŏl
+		// arg4... ől (  )
+		void fillFloat(float* out, const uint32_t num, const float min_value = 0.0f, const float max_value = 1.0f) noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// ݂̃Xbhp̐
+		// tips... Ăяo Rng::SetSeed ̃V[hƃXbh̐n񂪌܂܂
+		static Rng& Thread() noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// Xbhp̃V[hݒ
+		// tips... ĂяoXbh̐n 0 ƂčĐݒ肵Aȍ~ɏ߂ Rng::Thread() Ă񂾃Xbh
+		//         ̏Ōn 1, 2, ... 蓖Ē܂
+		// tips...  Rng::Thread() gp̃Xbh͕̐ύXȂ̂ŁA
+		//         XbhœʂČɂ̓Xbh𐶐OɌĂяoĂ
+		static void SetSeed(const uint64_t seed_value) noexcept;
+
+	private:
+		uint64_t s_[4];
+
+		static inline uint64_t Rotl(const uint64_t x, const int k) noexcept { return (x << k) | (x >> (64 - k)); }
+	};
+
+}
@@ -8,9 +8,10 @@ namespace tnl {
 		play();
 		if (frame_functions_storage_.empty()) return;
 		uint32_t start_frame = (ePlayDir::REVERSE == play_dir_) ? total_frame_num_ - 1 : 0;
-		if (!frame_functions_storage_[start_frame]) return;
+		const std::function<void()>* func = findFrameTrigger(start_frame);
+		if (!func) return;
 		if (call_of_trigger_) return;
-		call_of_trigger_ = frame_functions_storage_[start_frame];
+		call_of_trigger_ = *func;
 	}
 
 	//-------------------------------------------------------------------------------------------------------
@@ -25,8 +26,9 @@ namespace tnl {
 		seek_position_ = (static_cast<double>(frame) / static_cast<double>(total_frame_num_)) * total_time_;
 		seek_position_ = std::clamp<double>(seek_position_, 0, total_time_);
 		if (frame_functions_storage_.empty()) return;
-		if (!frame_functions_storage_[frame]) return;
-		call_of_trigger_ = frame_functions_storage_[frame];
+		const std::function<void()>* func = findFrameTrigger(frame);
+		if (!func) return;
+		call_of_trigger_ = *func;
 	}
 
 	//-------------------------------------------------------------------------------------------------------
@@ -38,9 +40,8 @@ namespace tnl {
 		uint32_t update_frame = getSeekFrame(eFrameType::CURRENT);
 		update_frame %= total_frame_num_;
 		if (update_frame != frame) {
-			if (!call_of_trigger_ && frame_functions_storage_[update_frame]) {
-				call_of_trigger_ = frame_functions_storage_[update_frame];
-			}
+			const std::function<void()>* func = call_of_trigger_ ? nullptr : findFrameTrigger(update_frame);
+			if (func) call_of_trigger_ = *func;
 		}
 		if (!call_of_trigger_) return;
 		call_of_trigger_();
@@ -50,9 +51,16 @@ namespace tnl {
 
 	//-------------------------------------------------------------------------------------------------------
 	void SeekUnit::setFrameTriggerFunction(const uint32_t& frame, std::function<void()> func) {
-		if (frame_functions_storage_.empty()) return;
-		if (frame_functions_storage_.size() <= frame) return;
-		frame_functions_storage_[frame] = func;
+		if (!is_frame_trigger_enable_) return;
+		if (total_frame_num_ <= frame) return;
+		auto it = std::lower_bound(frame_functions_storage_.begin(), frame_functions_storage_.end(), frame, [](const std::pair<uint32_t, std::function<void()>>& e, const uint32_t f) {
+			return e.first < f;
+		});
+		if (it != frame_functions_storage_.end() && it->first == frame) {
+			if (func) it->second = func;
+			else frame_functions_storage_.erase(it);
+		}
+		else if (func) frame_functions_storage_.insert(it, { frame, func });
 		uint32_t start_frame = (ePlayDir::REVERSE == play_dir_) ? total_frame_num_ - 1 : 0;
 		if (start_frame == frame) call_of_trigger_ = func;
 	}
@@ -110,7 +118,18 @@ namespace tnl {
 			return;
 		}
 		total_frame_num_ = frame_num;
-		frame_functions_storage_.resize(total_frame_num_);
+		is_frame_trigger_enable_ = true;
+		// ͈͊OɂȂR[obNj
+		while (!frame_functions_storage_.empty() && frame_functions_storage_.back().first >= total_frame_num_) frame_functions_storage_.pop_back();
+	}
+
+	//-------------------------------------------------------------------------------------------------------
+	const std::function<void()>* SeekUnit::findFrameTrigger(const uint32_t frame) const {
+		auto it = std::lower_bound(frame_functions_storage_.begin(), frame_functions_storage_.end(), frame, [](const std::pair<uint32_t, std::function<void()>>& e, const uint32_t f) {
+			return e.first < f;
+		});
+		if (it == frame_functions_storage_.end() || it->first != frame || !it->second) return nullptr;
+		return &it->second;
 	}
 
 	//-------------------------------------------------------------------------------------------------------
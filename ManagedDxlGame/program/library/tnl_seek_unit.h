@@ -2,6 +2,7 @@
 #include <vector>
 #include <algorithm>
 #include <functional>
+#include <utility>
 #include "tnl_using.h"
 #include "tnl_shared_factory.h"
 
@@ -94,6 +95,7 @@ namespace tnl {
 		// t[̍ĐJnɂPxsR[obNݒ
 		// arg1... t[ԍ
 		// arg2... R[obN
+		// tips... R[obN̓t[ԍ̔zŕێ̂ŁAt[Ɋւ炸o^gp܂
 		void setFrameTriggerFunction(const uint32_t& frame, std::function<void()> func);
 
 		//-------------------------------------------------------------------------------------------------------
@@ -102,6 +104,21 @@ namespace tnl {
 		//
 		inline uint32_t getTotalFrameNum() { return total_frame_num_; }
 
+		// Ŝ̍Đ
+		inline double getTotalTime() const { return total_time_; }
+
+		// ݂̃V[N
+		inline double getSeekTime() const { return seek_position_; }
+
+		// Đ
+		inline bool isPlaying() const { return is_playing_; }
+
+		// Đ[h
+		inline ePlayMode getPlayMode() const { return play_mode_; }
+
+		// ݂̍Đ ( REFLECTION ł͐܂Ԃxɕς܂ )
+		inline ePlayDir getCurrentPlayDir() const { return (direction_ < 0) ? ePlayDir::REVERSE : ePlayDir::FORWARD; }
+
 		// ݂̑Ŝ̃V[NԂ̊ 0 ` 1.0 ŕԂ
 		inline double getSeekRate() { return seek_position_ / total_time_; }
 
@@ -121,12 +138,17 @@ namespace tnl {
 		int32_t direction_ = 1;
 		uint32_t total_frame_num_ = 0;
 		std::function<void()> call_of_trigger_ = nullptr;
-		std::vector<std::function<void()>> frame_functions_storage_;
+		bool is_frame_trigger_enable_ = false;
+		// t[ԍɕׂR[obN
+		std::vector<std::pair<uint32_t, std::function<void()>>> frame_functions_storage_;
 		ePlayMode play_mode_ = ePlayMode::SINGLE;
 		ePlayDir play_dir_ = ePlayDir::FORWARD;
 
 		void seekProcess(float delta_time);
 
+		// wt[̃R[obN (  nullptr )
+		const std::function<void()>* findFrameTrigger(const uint32_t frame) const;
+
 		// Ŝ̍ĐԂݒ
 		inline void setTotalTime(const double total_time) { total_time_ = total_time; }
 
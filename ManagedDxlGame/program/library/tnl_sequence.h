@@ -1,6 +1,6 @@
 #pragma once
-#include <stack>
-#include <functional>
+#include <cstdint>
+#include <climits>
 
 namespace tnl {
 
@@ -49,17 +49,23 @@ void gameMain(float delta_time) {
 
 *****************************************************************************************************/
 
-	template <class T>
+	//-----------------------------------------------------------------------------------------------------
+	// T [ ܃NX ]
+	// HISTORY_SIZE [ undo Ŗ߂闚̐ ( ͌Â̂j ) ]
+	// tips... o֐|C^𒼐ڌĂяôŁAύXXVœImۂ͍s܂
+	//
+	template <class T, uint32_t HISTORY_SIZE = 16>
 	class Sequence final {
 	private:
+		static_assert(HISTORY_SIZE > 0, "HISTORY_SIZE must be greater than 0");
+		using func_type = bool (T::*)(const float);
+
 		T* object_;
-		std::function<bool(T*, const float)> now_;
-		std::function<bool(T*, const float)> next_;
-		std::stack<std::function<bool(T*, const float)>> prevs_;
-		bool (T::*p_now_)(const float);
-		bool (T::*p_next_)(const float);
-		typedef bool (T::*p_prev_)(const float) ;
-		std::stack<p_prev_> p_prevs_;
+		func_type p_now_;
+		func_type p_next_;
+		func_type p_prevs_[HISTORY_SIZE];	// Oobt@
+		uint32_t prev_head_ = 0;			// ɏވʒu
+		uint32_t prev_num_ = 0;
 		bool is_start_ = true;
 		bool is_change_ = false;
 		float sum_time_ = 0;
@@ -72,17 +78,21 @@ void gameMain(float delta_time) {
 		bool co_is_break_ = false;
 
 		Sequence() {}
+
+		inline void pushHistory(func_type func) noexcept {
+			p_prevs_[prev_head_] = func;
+			prev_head_ = (prev_head_ + 1) % HISTORY_SIZE;
+			if (prev_num_ < HISTORY_SIZE) ++prev_num_;
+		}
 	public:
 
 		//===================================================================================
 		// RXgN^
 		// arg1... ܃NX this |C^w
-		// arg2... R[obNŌĂяo܃NX̃o\bh܂̓_w
+		// arg2... R[obNŌĂяo܃NX̃o\bhw
 		//===================================================================================
 		Sequence(T* obj, bool (T::*func)(const float))
 			: object_(obj)
-			, next_(func)
-			, now_(func)
 			, p_now_(func)
 			, p_next_(func)
 		{}
@@ -95,13 +105,12 @@ void gameMain(float delta_time) {
 		//===================================================================================
 		inline bool update(const float deltatime) {
 			sum_time_ += deltatime;
-			bool ret = now_(object_, deltatime);
+			bool ret = (object_->*p_now_)(deltatime);
 			sum_frame_++;
 			if (!is_change_) {
 				is_start_ = false;
 				return ret;
 			}
-			now_ = next_;
 			p_now_ = p_next_;
 			is_start_ = true;
 			sum_time_ = 0;
@@ -136,9 +145,7 @@ void gameMain(float delta_time) {
 		// arg1... ̃t[s܃NX̃\bhw
 		//===================================================================================
 		inline void change(bool (T::*func)(const float)) {
-			prevs_.push(now_);
-			p_prevs_.push(p_now_);
-			next_ = func;
+			pushHistory(p_now_);
 			p_next_ = func;
 			is_change_ = true;
 		}
@@ -146,13 +153,13 @@ void gameMain(float delta_time) {
 		//===================================================================================
 		// 1ÕV[PXɖ߂
 		// tips... ÕV[PX݂ȂΉȂ
+		// tips... k̂͒ HISTORY_SIZE ̕ύX܂
 		//===================================================================================
 		inline void undo() {
-			if (prevs_.empty()) return;			
-			next_ = prevs_.top();
-			p_next_ = p_prevs_.top();
-			prevs_.pop();
-			p_prevs_.pop();
+			if (0 == prev_num_) return;
+			prev_head_ = (prev_head_ + HISTORY_SIZE - 1) % HISTORY_SIZE;
+			--prev_num_;
+			p_next_ = p_prevs_[prev_head_];
 			is_change_ = true;
 		}
 
@@ -163,9 +170,7 @@ void gameMain(float delta_time) {
 		// tisp... t[҂ɃV[PXύX
 		//===================================================================================
 		inline void immediatelyChange(bool (T::*func)(const float)) {
-			prevs_.push(now_);
-			p_prevs_.push(p_now_);
-			now_ = func;
+			pushHistory(p_now_);
 			p_now_ = func;
 			is_start_ = true;
 			sum_time_ = 0;
@@ -229,7 +234,8 @@ void gameMain(float delta_time) {
 		inline int32_t	_co_get_prog_frame_() { return co_frame_; }
 		inline float	_co_get_prog_time_() { return co_time_; }
 		inline void		_co_reset_call_count_() { co_call_count_ = 0; }
-		inline bool		_co_yield_by_frame_(int32_t limit_frame, float delta_time, const std::function<void()>& logic) {
+		template <class Logic>
+		inline bool		_co_yield_by_frame_(int32_t limit_frame, float delta_time, Logic&& logic) {
 			if (co_call_count_++ == co_call_through_) {
 				int32_t limit = (0 > limit_frame) ? INT32_MAX : limit_frame;
 				if (co_frame_ >= limit) return true;
@@ -248,7 +254,8 @@ void gameMain(float delta_time) {
 			}
 			return false;
 		}
-		inline bool		_co_yield_by_time_(float limit_time, float delta_time, const std::function<void()>& logic) {
+		template <class Logic>
+		inline bool		_co_yield_by_time_(float limit_time, float delta_time, Logic&& logic) {
 			if (co_call_count_++ == co_call_through_) {
 				if (co_time_ >= limit_time) return true;
 				co_call_count_ = 0;
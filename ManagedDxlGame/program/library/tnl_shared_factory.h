@@ -1,6 +1,8 @@
 #pragma once
 #include <any>
 #include <memory>
+#include <type_traits>
+#include "tnl_slab_allocator.h"
 
 namespace tnl {
 
@@ -12,6 +14,12 @@ namespace tnl {
 	//       Ƃ shared_from_this_shared_from_this_constructor 
 	//       hNXł͂̉z֐ shared_from_this gRXgN^ƂĎgp
 	//
+	// tips: Create ŐIuWFNg͌^Ƃ̃XuAP[^ ( SlabPool ) 
+	//       ubNƈꏏ 1 ubNŊ蓖Ă܂
+	//       ^Ƃ̐Eő吔 GetAllocStats<U>()  SlabPool::GetAllStats ŊmFł܂
+	//       XuŐIuWFNg̓IȌ^ U ̔h^ ( SharedFactory::Slab<U> ) ɂȂ܂
+	//       U  final ̏ꍇRXgN^ private ̏ꍇ͏]ǂʂɊ蓖Ă܂
+	//
 
 	template< class T >
 	class SharedFactory : public std::enable_shared_from_this<T> {
@@ -20,6 +28,29 @@ namespace tnl {
 		// new ̎gp֎~
 		static void* operator new(size_t i) { return _mm_malloc(i, 16); }
 
+		// Xu蓖ėp U ̃RXgN^Jh^
+		template< class U >
+		class Slab final : public U {
+		public:
+			Slab() = default;
+		};
+
+		template< class U >
+		static constexpr bool IsSlabAllocatable() {
+			if constexpr (std::is_final_v<U>) return false;
+			else return std::is_default_constructible_v<Slab<U>>;
+		}
+
+		template< class U >
+		static std::shared_ptr<U> Allocate() {
+			if constexpr (IsSlabAllocatable<U>()) {
+				return std::allocate_shared<Slab<U>>(SlabAllocator<Slab<U>, U>());
+			}
+			else {
+				return std::shared_ptr<U>(new U());
+			}
+		}
+
 	protected : 
 		SharedFactory() {}
 
@@ -40,7 +71,7 @@ namespace tnl {
 		// Ȃ̐֐
 		template< class U >
 		static [[nodiscard]] std::shared_ptr<U> Create() {
-			std::shared_ptr<U> ptr = std::shared_ptr<U>(new U());
+			std::shared_ptr<U> ptr = Allocate<U>();
 			ptr->shared_from_this_constructor();
 			return ptr;
 		}
@@ -48,7 +79,7 @@ namespace tnl {
 		// shared_from_this_constructor R[Ȃ
 		template< class U >
 		static [[nodiscard]] std::shared_ptr<U> NonCalledSharedConstructorCreate() {
-			std::shared_ptr<U> ptr = std::shared_ptr<U>(new U());
+			std::shared_ptr<U> ptr = Allocate<U>();
 			return ptr;
 		}
 
@@ -56,11 +87,21 @@ namespace tnl {
 		// t̐֐
 		template< class U >
 		static [[nodiscard]] std::shared_ptr<U> Create(const std::any& desc) {
-			std::shared_ptr<U> ptr = std::shared_ptr<U>( new U() );
+			std::shared_ptr<U> ptr = Allocate<U>();
 			ptr->shared_from_this_accomp_desc_constructor(desc);
 			return ptr;
 		}
 
+		//-----------------------------------------------------------------------------------
+		// ^Ƃ̊蓖ď󋵂̎擾
+		// ret.... Xu 1 xĂȂ^͑S 0
+		template< class U >
+		static SlabStats GetAllocStats() {
+			SlabStats stats = { typeid(U).name(), 0, 0, 0, 0, 0 };
+			SlabPool::FindStats(typeid(U), stats);
+			return stats;
+		}
+
 	};
 
 
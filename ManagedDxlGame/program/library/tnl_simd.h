@@ -0,0 +1,401 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include "../tnl_build_switch.h"
+
+//----------------------------------------------------------------------------------------------
+// SIMD obNGh̑I
+// tips... RpC`閽߃Zbg̃}NrhɎőI܂
+//         tnl_build_switch.h  TNL_BUILD_SWITCH_SIMD_SCALAR `
+//         ߃ZbgɊւ炸XJ[Ńrh܂
+#if defined(TNL_BUILD_SWITCH_SIMD_SCALAR)
+	#define TNL_SIMD_SCALAR
+#elif defined(__AVX2__)
+	#define TNL_SIMD_AVX2
+	#define TNL_SIMD_SSE
+	#if defined(__FMA__) || defined(_MSC_VER)
+		#define TNL_SIMD_FMA
+	#endif
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+	#define TNL_SIMD_SSE
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define TNL_SIMD_NEON
+#else
+	#define TNL_SIMD_SCALAR
+#endif
+
+#if defined(TNL_SIMD_SSE)
+#include <immintrin.h>
+#elif defined(TNL_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace tnl {
+
+	//----------------------------------------------------------------------------------------------
+	// wNX̊i[pf[^^
+	// tips... Vector3 / Quaternion / Matrix ̊NXł
+	//         CAEg DirectXMath  XMFLOAT3 / XMFLOAT4 / XMFLOAT4X4 Ɠł
+	struct Float3 {
+		float x, y, z;
+		Float3() = default;
+		constexpr Float3(const float xx, const float yy, const float zz) noexcept : x(xx), y(yy), z(zz) {}
+	};
+
+	struct Float4 {
+		float x, y, z, w;
+		Float4() = default;
+		constexpr Float4(const float xx, const float yy, const float zz, const float ww) noexcept : x(xx), y(yy), z(zz), w(ww) {}
+	};
+
+	struct Float4x4 {
+		union {
+			struct {
+				float _11, _12, _13, _14;
+				float _21, _22, _23, _24;
+				float _31, _32, _33, _34;
+				float _41, _42, _43, _44;
+			};
+			float m[4][4];
+		};
+		Float4x4() = default;
+		Float4x4(
+			const float m00, const float m01, const float m02, const float m03,
+			const float m10, const float m11, const float m12, const float m13,
+			const float m20, const float m21, const float m22, const float m23,
+			const float m30, const float m31, const float m32, const float m33) noexcept
+			: _11(m00), _12(m01), _13(m02), _14(m03)
+			, _21(m10), _22(m11), _23(m12), _24(m13)
+			, _31(m20), _32(m21), _33(m22), _34(m23)
+			, _41(m30), _42(m31), _43(m32), _44(m33)
+		{}
+	};
+
+namespace simd {
+
+	//----------------------------------------------------------------------------------------------
+	// ZpWX^^
+	// vec4... 4 vf float xNg
+	// mat4... sxNg 4 {̍s ( DirectXMath ƓsDEsxNgK )
+#if defined(TNL_SIMD_SSE)
+	using vec4 = __m128;
+#elif defined(TNL_SIMD_NEON)
+	using vec4 = float32x4_t;
+#else
+	// tips... Ŵɂ Vector3 ւ { x, y, z } BɂȂ邽߃RXgN^錾Ă
+	struct vec4 {
+		vec4() noexcept = default;
+		float f[4];
+	};
+#endif
+	struct mat4 { vec4 r[4]; };
+
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// E[hEXgA
+	//
+#if defined(TNL_SIMD_SSE)
+	inline vec4 Set(const float x, const float y, const float z, const float w) noexcept { return _mm_set_ps(w, z, y, x); }
+	inline vec4 Splat(const float s) noexcept { return _mm_set1_ps(s); }
+	inline vec4 Zero() noexcept { return _mm_setzero_ps(); }
+	inline vec4 Load4(const float* p) noexcept { return _mm_loadu_ps(p); }
+	inline void Store4(float* p, const vec4 v) noexcept { _mm_storeu_ps(p, v); }
+	// tips... xy  8 byte  __m128i oRœǂݏ ( double* oR strict aliasing ᔽōœKɌÂlǂ )
+	inline vec4 Load3(const float* p) noexcept {
+		__m128 xy = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+		__m128 z = _mm_load_ss(p + 2);
+		return _mm_movelh_ps(xy, z);
+	}
+	inline void Store3(float* p, const vec4 v) noexcept {
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(v));
+		_mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+	}
+	inline float GetX(const vec4 v) noexcept { return _mm_cvtss_f32(v); }
+	inline float GetY(const vec4 v) noexcept { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))); }
+	inline float GetZ(const vec4 v) noexcept { return _mm_cvtss_f32(_mm_movehl_ps(v, v)); }
+	inline float GetW(const vec4 v) noexcept { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))); }
+	inline vec4 SplatX(const vec4 v) noexcept { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)); }
+	inline vec4 SplatY(const vec4 v) noexcept { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)); }
+	inline vec4 SplatZ(const vec4 v) noexcept { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)); }
+	inline vec4 SplatW(const vec4 v) noexcept { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)); }
+#elif defined(TNL_SIMD_NEON)
+	inline vec4 Set(const float x, const float y, const float z, const float w) noexcept {
+		const float f[4] = { x, y, z, w };
+		return vld1q_f32(f);
+	}
+	inline vec4 Splat(const float s) noexcept { return vdupq_n_f32(s); }
+	inline vec4 Zero() noexcept { return vdupq_n_f32(0.0f); }
+	inline vec4 Load4(const float* p) noexcept { return vld1q_f32(p); }
+	inline void Store4(float* p, const vec4 v) noexcept { vst1q_f32(p, v); }
+	inline vec4 Load3(const float* p) noexcept { return vcombine_f32(vld1_f32(p), vld1_lane_f32(p + 2, vdup_n_f32(0.0f), 0)); }
+	inline void Store3(float* p, const vec4 v) noexcept {
+		vst1_f32(p, vget_low_f32(v));
+		vst1q_lane_f32(p + 2, v, 2);
+	}
+	inline float GetX(const vec4 v) noexcept { return vgetq_lane_f32(v, 0); }
+	inline float GetY(const vec4 v) noexcept { return vgetq_lane_f32(v, 1); }
+	inline float GetZ(const vec4 v) noexcept { return vgetq_lane_f32(v, 2); }
+	inline float GetW(const vec4 v) noexcept { return vgetq_lane_f32(v, 3); }
+	inline vec4 SplatX(const vec4 v) noexcept { return vdupq_laneq_f32(v, 0); }
+	inline vec4 SplatY(const vec4 v) noexcept { return vdupq_laneq_f32(v, 1); }
+	inline vec4 SplatZ(const vec4 v) noexcept { return vdupq_laneq_f32(v, 2); }
+	inline vec4 SplatW(const vec4 v) noexcept { return vdupq_laneq_f32(v, 3); }
+#else
+	inline vec4 Set(const float x, const float y, const float z, const float w) noexcept {
+		vec4 v;
+		v.f[0] = x; v.f[1] = y; v.f[2] = z; v.f[3] = w;
+		return v;
+	}
+	inline vec4 Splat(const float s) noexcept { return Set(s, s, s, s); }
+	inline vec4 Zero() noexcept { return Set(0.0f, 0.0f, 0.0f, 0.0f); }
+	inline vec4 Load4(const float* p) noexcept { return Set(p[0], p[1], p[2], p[3]); }
+	inline void Store4(float* p, const vec4 v) noexcept { p[0] = v.f[0]; p[1] = v.f[1]; p[2] = v.f[2]; p[3] = v.f[3]; }
+	inline vec4 Load3(const float* p) noexcept { return Set(p[0], p[1], p[2], 0.0f); }
+	inline void Store3(float* p, const vec4 v) noexcept { p[0] = v.f[0]; p[1] = v.f[1]; p[2] = v.f[2]; }
+	inline float GetX(const vec4 v) noexcept { return v.f[0]; }
+	inline float GetY(const vec4 v) noexcept { return v.f[1]; }
+	inline float GetZ(const vec4 v) noexcept { return v.f[2]; }
+	inline float GetW(const vec4 v) noexcept { return v.f[3]; }
+	inline vec4 SplatX(const vec4 v) noexcept { return Splat(v.f[0]); }
+	inline vec4 SplatY(const vec4 v) noexcept { return Splat(v.f[1]); }
+	inline vec4 SplatZ(const vec4 v) noexcept { return Splat(v.f[2]); }
+	inline vec4 SplatW(const vec4 v) noexcept { return Splat(v.f[3]); }
+#endif
+
+	inline vec4 Load3(const Float3& f) noexcept { return Load3(&f.x); }
+	inline vec4 Load4(const Float4& f) noexcept { return Load4(&f.x); }
+	inline void Store3(Float3& f, const vec4 v) noexcept { Store3(&f.x, v); }
+	inline void Store4(Float4& f, const vec4 v) noexcept { Store4(&f.x, v); }
+
+	// w vf 1 ݒ肵ă[h ( Wϊp )
+	inline vec4 Load3Point(const Float3& f) noexcept { return Set(f.x, f.y, f.z, 1.0f); }
+
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// lZ
+	//
+#if defined(TNL_SIMD_SSE)
+	inline vec4 Add(const vec4 a, const vec4 b) noexcept { return _mm_add_ps(a, b); }
+	inline vec4 Sub(const vec4 a, const vec4 b) noexcept { return _mm_sub_ps(a, b); }
+	inline vec4 Mul(const vec4 a, const vec4 b) noexcept { return _mm_mul_ps(a, b); }
+	inline vec4 Div(const vec4 a, const vec4 b) noexcept { return _mm_div_ps(a, b); }
+	inline vec4 Min(const vec4 a, const vec4 b) noexcept { return _mm_min_ps(a, b); }
+	inline vec4 Max(const vec4 a, const vec4 b) noexcept { return _mm_max_ps(a, b); }
+	inline vec4 Neg(const vec4 a) noexcept { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+	// a * b + c
+	inline vec4 MulAdd(const vec4 a, const vec4 b, const vec4 c) noexcept {
+	#if defined(TNL_SIMD_FMA)
+		return _mm_fmadd_ps(a, b, c);
+	#else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+	#endif
+	}
+#elif defined(TNL_SIMD_NEON)
+	inline vec4 Add(const vec4 a, const vec4 b) noexcept { return vaddq_f32(a, b); }
+	inline vec4 Sub(const vec4 a, const vec4 b) noexcept { return vsubq_f32(a, b); }
+	inline vec4 Mul(const vec4 a, const vec4 b) noexcept { return vmulq_f32(a, b); }
+	inline vec4 Div(const vec4 a, const vec4 b) noexcept { return vdivq_f32(a, b); }
+	inline vec4 Min(const vec4 a, const vec4 b) noexcept { return vminq_f32(a, b); }
+	inline vec4 Max(const vec4 a, const vec4 b) noexcept { return vmaxq_f32(a, b); }
+	inline vec4 Neg(const vec4 a) noexcept { return vnegq_f32(a); }
+	inline vec4 MulAdd(const vec4 a, const vec4 b, const vec4 c) noexcept { return vfmaq_f32(c, a, b); }
+#else
+	inline vec4 Add(const vec4 a, const vec4 b) noexcept { return Set(a.f[0] + b.f[0], a.f[1] + b.f[1], a.f[2] + b.f[2], a.f[3] + b.f[3]); }
+	inline vec4 Sub(const vec4 a, const vec4 b) noexcept { return Set(a.f[0] - b.f[0], a.f[1] - b.f[1], a.f[2] - b.f[2], a.f[3] - b.f[3]); }
+	inline vec4 Mul(const vec4 a, const vec4 b) noexcept { return Set(a.f[0] * b.f[0], a.f[1] * b.f[1], a.f[2] * b.f[2], a.f[3] * b.f[3]); }
+	inline vec4 Div(const vec4 a, const vec4 b) noexcept { return Set(a.f[0] / b.f[0], a.f[1] / b.f[1], a.f[2] / b.f[2], a.f[3] / b.f[3]); }
+	inline vec4 Min(const vec4 a, const vec4 b) noexcept {
+		return Set((a.f[0] < b.f[0]) ? a.f[0] : b.f[0], (a.f[1] < b.f[1]) ? a.f[1] : b.f[1], (a.f[2] < b.f[2]) ? a.f[2] : b.f[2], (a.f[3] < b.f[3]) ? a.f[3] : b.f[3]);
+	}
+	inline vec4 Max(const vec4 a, const vec4 b) noexcept {
+		return Set((a.f[0] > b.f[0]) ? a.f[0] : b.f[0], (a.f[1] > b.f[1]) ? a.f[1] : b.f[1], (a.f[2] > b.f[2]) ? a.f[2] : b.f[2], (a.f[3] > b.f[3]) ? a.f[3] : b.f[3]);
+	}
+	inline vec4 Neg(const vec4 a) noexcept { return Set(-a.f[0], -a.f[1], -a.f[2], -a.f[3]); }
+	inline vec4 MulAdd(const vec4 a, const vec4 b, const vec4 c) noexcept { return Add(Mul(a, b), c); }
+#endif
+
+	inline vec4 Scale(const vec4 v, const float s) noexcept { return Mul(v, Splat(s)); }
+
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// xNgZ
+	//
+#if defined(TNL_SIMD_SSE)
+	inline float Dot3(const vec4 a, const vec4 b) noexcept {
+		__m128 m = _mm_mul_ps(a, b);
+		__m128 y = _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1));
+		__m128 z = _mm_movehl_ps(m, m);
+		return _mm_cvtss_f32(_mm_add_ss(_mm_add_ss(m, y), z));
+	}
+	inline float Dot4(const vec4 a, const vec4 b) noexcept {
+		__m128 m = _mm_mul_ps(a, b);
+		__m128 s = _mm_add_ps(m, _mm_movehl_ps(m, m));
+		return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+	inline vec4 Cross3(const vec4 a, const vec4 b) noexcept {
+		__m128 a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+		__m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+		__m128 c = _mm_sub_ps(_mm_mul_ps(a, b_yzx), _mm_mul_ps(a_yzx, b));
+		return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+#elif defined(TNL_SIMD_NEON)
+	inline float Dot3(const vec4 a, const vec4 b) noexcept { return vaddvq_f32(vsetq_lane_f32(0.0f, vmulq_f32(a, b), 3)); }
+	inline float Dot4(const vec4 a, const vec4 b) noexcept { return vaddvq_f32(vmulq_f32(a, b)); }
+	inline vec4 Cross3(const vec4 a, const vec4 b) noexcept {
+		return Set(
+			GetY(a) * GetZ(b) - GetZ(a) * GetY(b),
+			GetZ(a) * GetX(b) - GetX(a) * GetZ(b),
+			GetX(a) * GetY(b) - GetY(a) * GetX(b), 0.0f);
+	}
+#else
+	inline float Dot3(const vec4 a, const vec4 b) noexcept { return a.f[0] * b.f[0] + a.f[1] * b.f[1] + a.f[2] * b.f[2]; }
+	inline float Dot4(const vec4 a, const vec4 b) noexcept { return a.f[0] * b.f[0] + a.f[1] * b.f[1] + a.f[2] * b.f[2] + a.f[3] * b.f[3]; }
+	inline vec4 Cross3(const vec4 a, const vec4 b) noexcept {
+		return Set(
+			a.f[1] * b.f[2] - a.f[2] * b.f[1],
+			a.f[2] * b.f[0] - a.f[0] * b.f[2],
+			a.f[0] * b.f[1] - a.f[1] * b.f[0], 0.0f);
+	}
+#endif
+
+	inline float Length3(const vec4 v) noexcept { return std::sqrt(Dot3(v, v)); }
+
+	// tips...  0 ̃xNg 0 xNgԂ ( XMVector3Normalize Ɠ )
+	inline vec4 Normalize3(const vec4 v) noexcept {
+		float len = Length3(v);
+		return (len > 0.0f) ? Div(v, Splat(len)) : Zero();
+	}
+	inline vec4 Normalize4(const vec4 v) noexcept {
+		float len = std::sqrt(Dot4(v, v));
+		return (len > 0.0f) ? Div(v, Splat(len)) : Zero();
+	}
+
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// s񉉎Z
+	//
+	inline mat4 LoadMatrix(const Float4x4& m) noexcept {
+		return { { Load4(m.m[0]), Load4(m.m[1]), Load4(m.m[2]), Load4(m.m[3]) } };
+	}
+	inline void StoreMatrix(Float4x4& out, const mat4& m) noexcept {
+		Store4(out.m[0], m.r[0]);
+		Store4(out.m[1], m.r[1]);
+		Store4(out.m[2], m.r[2]);
+		Store4(out.m[3], m.r[3]);
+	}
+
+	// sxNg v ƍs m ̐ ( v * m )
+	inline vec4 TransformRow(const vec4 v, const mat4& m) noexcept {
+		vec4 r = Mul(SplatX(v), m.r[0]);
+		r = MulAdd(SplatY(v), m.r[1], r);
+		r = MulAdd(SplatZ(v), m.r[2], r);
+		return MulAdd(SplatW(v), m.r[3], r);
+	}
+
+	// a * b
+	inline mat4 Multiply(const mat4& a, const mat4& b) noexcept {
+#if defined(TNL_SIMD_AVX2)
+		// 2 s 256bit ŏ
+		__m256 b0 = _mm256_broadcast_ps(&b.r[0]);
+		__m256 b1 = _mm256_broadcast_ps(&b.r[1]);
+		__m256 b2 = _mm256_broadcast_ps(&b.r[2]);
+		__m256 b3 = _mm256_broadcast_ps(&b.r[3]);
+		__m256 rows[2] = { _mm256_set_m128(a.r[1], a.r[0]), _mm256_set_m128(a.r[3], a.r[2]) };
+		mat4 out;
+		for (int i = 0; i < 2; ++i) {
+			__m256 a01 = rows[i];
+			__m256 r = _mm256_mul_ps(_mm256_shuffle_ps(a01, a01, 0x00), b0);
+	#if defined(TNL_SIMD_FMA)
+			r = _mm256_fmadd_ps(_mm256_shuffle_ps(a01, a01, 0x55), b1, r);
+			r = _mm256_fmadd_ps(_mm256_shuffle_ps(a01, a01, 0xaa), b2, r);
+			r = _mm256_fmadd_ps(_mm256_shuffle_ps(a01, a01, 0xff), b3, r);
+	#else
+			r = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(a01, a01, 0x55), b1), r);
+			r = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(a01, a01, 0xaa), b2), r);
+			r = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(a01, a01, 0xff), b3), r);
+	#endif
+			out.r[i * 2 + 0] = _mm256_castps256_ps128(r);
+			out.r[i * 2 + 1] = _mm256_extractf128_ps(r, 1);
+		}
+		return out;
+#else
+		return { { TransformRow(a.r[0], b), TransformRow(a.r[1], b), TransformRow(a.r[2], b), TransformRow(a.r[3], b) } };
+#endif
+	}
+
+	inline mat4 Transpose(const mat4& m) noexcept {
+#if defined(TNL_SIMD_SSE)
+		mat4 t = m;
+		_MM_TRANSPOSE4_PS(t.r[0], t.r[1], t.r[2], t.r[3]);
+		return t;
+#elif defined(TNL_SIMD_NEON)
+		float32x4_t t0 = vzip1q_f32(m.r[0], m.r[2]);
+		float32x4_t t1 = vzip1q_f32(m.r[1], m.r[3]);
+		float32x4_t t2 = vzip2q_f32(m.r[0], m.r[2]);
+		float32x4_t t3 = vzip2q_f32(m.r[1], m.r[3]);
+		return { { vzip1q_f32(t0, t1), vzip2q_f32(t0, t1), vzip1q_f32(t2, t3), vzip2q_f32(t2, t3) } };
+#else
+		mat4 t;
+		for (int i = 0; i < 4; ++i) {
+			for (int k = 0; k < 4; ++k) t.r[i].f[k] = m.r[k].f[i];
+		}
+		return t;
+#endif
+	}
+
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// NH[^jIZ
+	//
+
+	// tips... XMQuaternionMultiply Ɠ q1 ̉]̌ q2 ̉]sNH[^jIԂ
+	inline vec4 QuaternionMultiply(const vec4 q1, const vec4 q2) noexcept {
+#if defined(TNL_SIMD_SSE)
+		// q1 * w2 + q1.wzyx * x2 + q1.zwxy * y2 + q1.yxwz * z2 (  xor Ŕ] )
+		const __m128 wzyx = _mm_shuffle_ps(q1, q1, _MM_SHUFFLE(0, 1, 2, 3));
+		const __m128 zwxy = _mm_shuffle_ps(q1, q1, _MM_SHUFFLE(1, 0, 3, 2));
+		const __m128 yxwz = _mm_shuffle_ps(q1, q1, _MM_SHUFFLE(2, 3, 0, 1));
+		vec4 r = Mul(q1, SplatW(q2));
+		r = MulAdd(_mm_xor_ps(wzyx, _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f)), SplatX(q2), r);
+		r = MulAdd(_mm_xor_ps(zwxy, _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f)), SplatY(q2), r);
+		return MulAdd(_mm_xor_ps(yxwz, _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f)), SplatZ(q2), r);
+#else
+		float x1 = GetX(q1), y1 = GetY(q1), z1 = GetZ(q1), w1 = GetW(q1);
+		float x2 = GetX(q2), y2 = GetY(q2), z2 = GetZ(q2), w2 = GetW(q2);
+		return Set(
+			(w2 * x1) + (x2 * w1) + (y2 * z1) - (z2 * y1),
+			(w2 * y1) - (x2 * z1) + (y2 * w1) + (z2 * x1),
+			(w2 * z1) + (x2 * y1) - (y2 * x1) + (z2 * w1),
+			(w2 * w1) - (x2 * x1) - (y2 * y1) - (z2 * z1));
+#endif
+	}
+
+	inline vec4 QuaternionConjugate(const vec4 q) noexcept {
+		return Mul(q, Set(-1.0f, -1.0f, -1.0f, 1.0f));
+	}
+
+	inline vec4 QuaternionInverse(const vec4 q) noexcept {
+		float len_sq = Dot4(q, q);
+		if (len_sq <= 1.192092896e-7f) return Zero();
+		return Div(QuaternionConjugate(q), Splat(len_sq));
+	}
+
+	// xNg v NH[^jI q ŉ]
+	inline vec4 Rotate3(const vec4 v, const vec4 q) noexcept {
+		// v' = v + 2w(q x v) + 2(q x (q x v))
+		vec4 t = Scale(Cross3(q, v), 2.0f);
+		return Add(MulAdd(SplatW(q), t, v), Cross3(q, t));
+	}
+
+	// xNg v NH[^jI q ̋t]ŉ]
+	inline vec4 InverseRotate3(const vec4 v, const vec4 q) noexcept {
+		return Rotate3(v, QuaternionConjugate(q));
+	}
+
+}
+}
@@ -0,0 +1,92 @@
+#include "tnl_slab_allocator.h"
+
+namespace tnl {
+
+	namespace {
+		// ς݃v[̈ꗗ ( v[ƓjȂ )
+		std::mutex& RegistryMutex() {
+			static std::mutex* mtx = new std::mutex();
+			return *mtx;
+		}
+		std::vector<SlabPool*>& Registry() {
+			static std::vector<SlabPool*>* pools = new std::vector<SlabPool*>();
+			return *pools;
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	SlabPool::SlabPool(const size_t block_size, const size_t align, const std::type_info& type) : type_(type) {
+		align_ = (align > 16) ? align : 16;
+		size_t size = (block_size > sizeof(FreeBlock)) ? block_size : sizeof(FreeBlock);
+		block_size_ = (size + align_ - 1) / align_ * align_;
+		slab_block_num_ = SLAB_BYTES / block_size_;
+		if (slab_block_num_ < MIN_SLAB_BLOCK_NUM) slab_block_num_ = MIN_SLAB_BLOCK_NUM;
+
+		std::lock_guard<std::mutex> lock(RegistryMutex());
+		Registry().emplace_back(this);
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void* SlabPool::allocate() {
+		std::lock_guard<std::mutex> lock(mtx_);
+		if (!free_) {
+			// VXumۂđSubN󂫃Xg
+			char* slab = static_cast<char*>(::operator new(block_size_ * slab_block_num_, std::align_val_t(align_)));
+			slabs_.emplace_back(slab);
+			for (size_t i = slab_block_num_; i > 0; --i) {
+				FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + block_size_ * (i - 1));
+				block->next_ = free_;
+				free_ = block;
+			}
+		}
+		FreeBlock* block = free_;
+		free_ = block->next_;
+		++total_;
+		if (++live_ > peak_) peak_ = live_;
+		return block;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void SlabPool::deallocate(void* p) noexcept {
+		if (!p) return;
+		std::lock_guard<std::mutex> lock(mtx_);
+		FreeBlock* block = static_cast<FreeBlock*>(p);
+		block->next_ = free_;
+		free_ = block;
+		--live_;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	SlabStats SlabPool::getStats() {
+		std::lock_guard<std::mutex> lock(mtx_);
+		SlabStats stats;
+		stats.name_ = type_.name();
+		stats.block_size_ = static_cast<uint32_t>(block_size_);
+		stats.live_ = live_;
+		stats.peak_ = peak_;
+		stats.capacity_ = static_cast<uint32_t>(slabs_.size() * slab_block_num_);
+		stats.total_ = total_;
+		return stats;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	bool SlabPool::FindStats(const std::type_info& type, SlabStats& out) {
+		std::lock_guard<std::mutex> lock(RegistryMutex());
+		for (SlabPool* pool : Registry()) {
+			if (pool->type_ != type) continue;
+			out = pool->getStats();
+			return true;
+		}
+		return false;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void SlabPool::GetAllStats(std::vector<SlabStats>& out) {
+		std::lock_guard<std::mutex> lock(RegistryMutex());
+		out.clear();
+		for (SlabPool* pool : Registry()) {
+			out.emplace_back(pool->getStats());
+		}
+	}
+
+}
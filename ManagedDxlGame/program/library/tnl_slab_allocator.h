@@ -0,0 +1,140 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+#include <typeinfo>
+
+namespace tnl {
+
+	//----------------------------------------------------------------------------------------------
+	// XuAP[^̎gp
+	struct SlabStats {
+		const char*	name_;			// ^ ( typeid  name )
+		uint32_t	block_size_;	// 1 ubÑoCg
+		uint32_t	live_;			// gp̃ubN
+		uint32_t	peak_;			// gp̃ubN̍ől
+		uint32_t	capacity_;		// mۍς݂̃ubN
+		uint64_t	total_;			// ܂łɊ蓖ĂubN
+	};
+
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// ŒTCYubÑXuAP[^
+	//
+	// tips... 萔̃ubN܂Ƃ߂ĊmۂAꂽubN͋󂫃XgɌqōėp܂
+	//         ubN 16 byte ( ^̗vȏȂ炻̒l ) Eɔzu܂
+	//         mۂXu̓vOI܂ŃVXeɕԋp܂
+	//         ^Ƃ̃v[ SlabPool::Get ŐAGetAllStats Ŏgp󋵂ꗗł܂
+	//
+	class SlabPool final {
+	public:
+		SlabPool(const size_t block_size, const size_t align, const std::type_info& type);
+
+		//-----------------------------------------------------------------------------------------------------
+		// ubN̊mہE
+		void* allocate();
+		void deallocate(void* p) noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// ̃v[ňTCY
+		inline bool isFit(const size_t size, const size_t align) const noexcept {
+			return size <= block_size_ && align <= align_;
+		}
+
+		SlabStats getStats();
+
+		//-----------------------------------------------------------------------------------------------------
+		// ^Ƃ̃v[̎擾
+		// Tag [ v[ʂ^ ]
+		// arg1... ubÑoCg ( Ăяôݎgp )
+		// arg2... ubN̔zuE ( Ăяôݎgp )
+		// tips... v[͔jȂ̂ŁAÓIϐ̔jɊւ炸ł܂
+		template< class Tag >
+		static SlabPool& Get(const size_t block_size, const size_t align) {
+			static SlabPool* pool = new SlabPool(block_size, align, typeid(Tag));
+			return *pool;
+		}
+
+		//-----------------------------------------------------------------------------------------------------
+		// gp󋵂̎擾
+		// arg1... v[ʂ^ typeid
+		// arg2... gp󋵂̎󂯎p
+		// ret.... [ true : 擾 ] [ false : Yv[ ]
+		static bool FindStats(const std::type_info& type, SlabStats& out);
+
+		//-----------------------------------------------------------------------------------------------------
+		// Sv[̎gp󋵂̎擾
+		static void GetAllStats(std::vector<SlabStats>& out);
+
+	private:
+		// 1 Xû悻̃oCg ( ubN傫ꍇŒ MIN_SLAB_BLOCK_NUM ͊mۂ )
+		static constexpr size_t SLAB_BYTES = 64 * 1024;
+		static constexpr size_t MIN_SLAB_BLOCK_NUM = 16;
+
+		struct FreeBlock {
+			FreeBlock* next_;
+		};
+
+		std::mutex mtx_;
+		const std::type_info& type_;
+		size_t block_size_;
+		size_t align_;
+		size_t slab_block_num_;
+		FreeBlock* free_ = nullptr;
+		std::vector<void*> slabs_;
+		uint32_t live_ = 0;
+		uint32_t peak_ = 0;
+		uint64_t total_ = 0;
+	};
+
+
+	//----------------------------------------------------------------------------------------------
+	//
+	// SlabPool gpWCu݊̃AP[^
+	//
+	// T [ 蓖Ă^ ]
+	// Tag [ v[ʂ^ ]
+	// tips... vf 1 ̊蓖Ă̂݃v[sAȊO͒ʏ new Ŋ蓖Ă܂
+	//         std::allocate_shared ɓnƃIuWFNgƐubN 1 ubNɎ܂܂
+	//
+	template< class T, class Tag = T >
+	class SlabAllocator {
+	public:
+		using value_type = T;
+
+		SlabAllocator() noexcept {}
+		template< class U >
+		SlabAllocator(const SlabAllocator<U, Tag>&) noexcept {}
+
+		T* allocate(const size_t n) {
+			if (1 == n) {
+				SlabPool& pool = SlabPool::Get<Tag>(sizeof(T), ALIGN);
+				if (pool.isFit(sizeof(T), ALIGN)) return static_cast<T*>(pool.allocate());
+			}
+			return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(ALIGN)));
+		}
+
+		void deallocate(T* p, const size_t n) noexcept {
+			if (1 == n) {
+				SlabPool& pool = SlabPool::Get<Tag>(sizeof(T), ALIGN);
+				if (pool.isFit(sizeof(T), ALIGN)) {
+					pool.deallocate(p);
+					return;
+				}
+			}
+			::operator delete(p, std::align_val_t(ALIGN));
+		}
+
+		template< class U >
+		bool operator==(const SlabAllocator<U, Tag>&) const noexcept { return true; }
+		template< class U >
+		bool operator!=(const SlabAllocator<U, Tag>&) const noexcept { return false; }
+
+	private:
+		static constexpr size_t ALIGN = (alignof(T) > 16) ? alignof(T) : 16;
+	};
+
+}
@@ -0,0 +1,172 @@
+#include <algorithm>
+#include "tnl_timeline.h"
+
+namespace tnl {
+
+	//-----------------------------------------------------------------------------------------------------
+	Timeline::Timeline(const double total_time, const ePlayMode play_mode, const ePlayDir play_dir)
+		: seek_(60.0, total_time, 0, play_mode, play_dir)
+		, total_time_(total_time)
+	{
+		time_ = seek_.getSeekTime();
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	uint32_t Timeline::addTrack(const eInterp interp, float* target) {
+		Track track;
+		track.interp_ = interp;
+		track.target_ = target;
+		tracks_.emplace_back(std::move(track));
+		return static_cast<uint32_t>(tracks_.size() - 1);
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Timeline::addKey(const uint32_t track, const float time, const float value) {
+		Track& t = tracks_[track];
+		const size_t n = std::upper_bound(t.times_.begin(), t.times_.end(), time) - t.times_.begin();
+		t.times_.insert(t.times_.begin() + n, time);
+		t.values_.insert(t.values_.begin() + n, value);
+		t.cursor_ = 0;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Timeline::addEvent(const float time, const std::function<void()>& func) {
+		const size_t n = std::upper_bound(event_times_.begin(), event_times_.end(), time) - event_times_.begin();
+		event_times_.insert(event_times_.begin() + n, time);
+		event_functions_.insert(event_functions_.begin() + n, func);
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Timeline::clearKeys(const uint32_t track) {
+		Track& t = tracks_[track];
+		t.times_.clear();
+		t.values_.clear();
+		t.cursor_ = 0;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Timeline::clear() {
+		tracks_.clear();
+		event_times_.clear();
+		event_functions_.clear();
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Timeline::restart() {
+		seek_.restart();
+		time_ = seek_.getSeekTime();
+		is_include_start_ = true;
+		evaluateAll();
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Timeline::jumpSeekRate(const double seek_rate) {
+		seek_.jumpSeekRate(seek_rate);
+		time_ = seek_.getSeekTime();
+		is_include_start_ = true;
+		evaluateAll();
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Timeline::update(const double delta_time) {
+		if (!seek_.isPlaying()) return;
+
+		const double prev = time_;
+		const bool is_prev_forward = (ePlayDir::FORWARD == seek_.getCurrentPlayDir());
+		const bool is_include = is_include_start_;
+		is_include_start_ = false;
+
+		seek_.update(delta_time);
+		double now = seek_.getSeekTime();
+		const bool is_forward = (ePlayDir::FORWARD == seek_.getCurrentPlayDir());
+
+		// SeekUnit ̒PĐ͍ŏIt[̐擪Ŏ~܂̂ŁAI[܂ōĐ̂ƂĈ
+		if (ePlayMode::SINGLE == seek_.getPlayMode() && !seek_.isPlaying()) {
+			now = (is_prev_forward) ? total_time_ : 0;
+		}
+
+		if (is_forward == is_prev_forward) {
+			if (is_forward == (now >= prev)) {
+				fireEvents(prev, now, is_forward, is_include);
+			}
+			// s[gĐ̐܂Ԃ
+			else if (is_forward) {
+				fireEvents(prev, total_time_, true, is_include);
+				fireEvents(0, now, true, true);
+			}
+			else {
+				fireEvents(prev, 0, false, is_include);
+				fireEvents(total_time_, now, false, true);
+			}
+		}
+		// ]Đ̐܂Ԃ ( [̃Cxg 1 񂾂Ăяo )
+		else if (is_prev_forward) {
+			fireEvents(prev, total_time_, true, is_include);
+			fireEvents(total_time_, now, false, false);
+		}
+		else {
+			fireEvents(prev, 0, false, is_include);
+			fireEvents(0, now, true, false);
+		}
+
+		time_ = now;
+		evaluateAll();
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Timeline::fireEvents(const double from, const double to, const bool is_forward, const bool is_include_from) {
+		if (event_times_.empty()) return;
+		const float f = static_cast<float>(from);
+		const float t = static_cast<float>(to);
+		if (is_forward) {
+			// ( from, to ] 
+			size_t first = (is_include_from)
+				? std::lower_bound(event_times_.begin(), event_times_.end(), f) - event_times_.begin()
+				: std::upper_bound(event_times_.begin(), event_times_.end(), f) - event_times_.begin();
+			const size_t last = std::upper_bound(event_times_.begin(), event_times_.end(), t) - event_times_.begin();
+			for (; first < last; ++first) event_functions_[first]();
+		}
+		else {
+			// [ to, from ) ~
+			const size_t first = std::lower_bound(event_times_.begin(), event_times_.end(), t) - event_times_.begin();
+			size_t last = (is_include_from)
+				? std::upper_bound(event_times_.begin(), event_times_.end(), f) - event_times_.begin()
+				: std::lower_bound(event_times_.begin(), event_times_.end(), f) - event_times_.begin();
+			for (; last > first; --last) event_functions_[last - 1]();
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Timeline::evaluateAll() {
+		const float time = static_cast<float>(time_);
+		for (Track& track : tracks_) {
+			if (track.times_.empty()) continue;
+			track.value_ = evaluate(track, time);
+			if (track.target_) *track.target_ = track.value_;
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	float Timeline::evaluate(Track& track, const float time) {
+		const std::vector<float>& times = track.times_;
+		const uint32_t num = static_cast<uint32_t>(times.size());
+		if (time <= times[0]) return track.values_[0];
+		if (time >= times[num - 1]) return track.values_[num - 1];
+
+		// times[ i ] <= time < times[ i + 1 ] ƂȂ i T
+		// t[̍Đł͂قڑŐԂׂ̋ԂɂȂ̂ŁAȊO̎񕪒T
+		uint32_t i = track.cursor_;
+		if (i + 1 >= num || time < times[i] || times[i + 1] <= time) {
+			if (i + 2 < num && times[i + 1] <= time && time < times[i + 2]) ++i;
+			else if (i > 0 && i < num && times[i - 1] <= time && time < times[i]) --i;
+			else i = static_cast<uint32_t>(std::upper_bound(times.begin(), times.end(), time) - times.begin()) - 1;
+			track.cursor_ = i;
+		}
+
+		if (eInterp::STEP == track.interp_) return track.values_[i];
+		const float span = times[i + 1] - times[i];
+		const float rate = (span > 0) ? (time - times[i]) / span : 1.0f;
+		return track.values_[i] + (track.values_[i + 1] - track.values_[i]) * rate;
+	}
+
+}
@@ -0,0 +1,172 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <functional>
+#include "tnl_seek_unit.h"
+
+namespace tnl {
+
+	/*
+
+//
+//  gp@Tv
+//
+
+struct Sprite {
+	float x = 0;
+	float alpha = 0;
+	float anim_frame = 0;
+};
+Sprite sprites[300];
+tnl::Timeline timeline(2.0, tnl::Timeline::ePlayMode::REPEAT);
+
+void gameStart() {
+	for (int i = 0; i < 300; ++i) {
+		// IuWFNg x WƃAj[Vt[̃gbN
+		uint32_t move = timeline.addTrack(tnl::Timeline::eInterp::LINEAR, &sprites[i].x);
+		timeline.addKey(move, 0.0f, 0.0f);
+		timeline.addKey(move, 1.0f, 100.0f + i);
+		timeline.addKey(move, 2.0f, 0.0f);
+
+		uint32_t anim = timeline.addTrack(tnl::Timeline::eInterp::STEP, &sprites[i].anim_frame);
+		for (int k = 0; k < 8; ++k) timeline.addKey(anim, k * 0.25f, static_cast<float>(k));
+	}
+	timeline.addEvent(1.0f, []() { PlaySoundMem(...); });
+	timeline.restart();
+}
+
+void gameMain(float delta_time) {
+
+	// Đʒui߂đSgbN] ( 1 t[ 1  )
+	timeline.update(delta_time);
+}
+
+	*/
+
+	//------------------------------------------------------------------------------------------------------------
+	//
+	// 1 ̍Đʒuŕ̃gbNĐ^CC
+	//
+	// tips... Đʒu SeekUnit ŊǗASINGLE / REPEAT / REFLECTION  FORWARD / REVERSE gpł܂
+	//         L[t[ƃCxg͎ԏ̔zŕێ̂ŁA̓t[ł͂Ȃo^ɔႵ܂
+	//         L[t[̌͑ŐԂLbVAׂ̋ԂłȂΓ񕪒T܂
+	//         update 1 őSgbN]̂ŁÃIuWFNg̃Aj[V܂Ƃ߂čĐł܂
+	//
+	class Timeline final {
+	public:
+		using ePlayMode = SeekUnit::ePlayMode;
+		using ePlayDir = SeekUnit::ePlayDir;
+
+		// L[t[Ԃ̕ԕ@
+		enum class eInterp {
+			STEP,		// ÕL[̒l ( XvCg̃t[ԍȂ )
+			LINEAR		// `
+		};
+
+		//===================================================================================
+		// RXgN^
+		// arg1... Ŝ̍Đ ( b )
+		// arg2... ePlayMode
+		// arg3... ePlayDir
+		// tips... ͒~Ă܂ restart ܂ play ōĐJnĂ
+		//===================================================================================
+		Timeline(const double total_time, const ePlayMode play_mode = ePlayMode::SINGLE, const ePlayDir play_dir = ePlayDir::FORWARD);
+
+		//===================================================================================
+		// gbN̒ǉ
+		// arg1... ԕ@
+		// arg2... ]l̏ݐ ( ȗ getValue ł擾ł܂ )
+		// ret.... L[̒ǉɎgpgbNԍ
+		//===================================================================================
+		uint32_t addTrack(const eInterp interp = eInterp::LINEAR, float* target = nullptr);
+
+		//===================================================================================
+		// L[t[̒ǉ
+		// arg1... gbNԍ
+		// arg2...  ( b )
+		// arg3... l
+		// tips... ǉ͔Cӂł ( Ԃ̃L[͌ɒǉ̂ɕт܂ )
+		//===================================================================================
+		void addKey(const uint32_t track, const float time, const float value);
+
+		//===================================================================================
+		// Cxg̒ǉ
+		// arg1...  ( b )
+		// arg2... Đʒu arg1 ʉ߂ update ŌĂяoR[obN
+		// tips... tĐ͎Ԃ̍~ɌĂяo܂
+		//         R[obN̒ŃCxgǉȂł
+		//===================================================================================
+		void addEvent(const float time, const std::function<void()>& func);
+
+		//===================================================================================
+		// ]l̏ݐύX
+		//===================================================================================
+		inline void setTrackTarget(const uint32_t track, float* target) { tracks_[track].target_ = target; }
+
+		//===================================================================================
+		// gbÑL[t[Sč폜
+		//===================================================================================
+		void clearKeys(const uint32_t track);
+
+		//===================================================================================
+		// SgbNƃCxg̍폜
+		//===================================================================================
+		void clear();
+
+		// Đ( ~ꏊĐ )
+		inline void play() { seek_.play(); }
+		// ~
+		inline void stop() { seek_.stop(); }
+
+		// X^[g( n߂Đ JnʒũCxgĂяo܂ )
+		void restart();
+
+		// Đʒu 0 ` 1.0 ̊Ŏw肵ꏊ֔΂ ( ΂̃Cxg͎ update ŌĂяo܂ )
+		void jumpSeekRate(const double seek_rate);
+
+		// Ŝ̃Xs[hݒ
+		inline void setTimeScale(const double time_scale) { seek_.setTimeScale(time_scale); }
+
+		//===================================================================================
+		// Đʒui߁Aʉ߂CxǧĂяoƑSgbN̕]s ( t[s )
+		// arg1... t[Ԃ̌oߎ( bw )
+		//===================================================================================
+		void update(const double delta_time);
+
+		// gbN̕]l ( Ō update _̒l )
+		inline float getValue(const uint32_t track) const { return tracks_[track].value_; }
+
+		// ݂̍Đʒu ( b )
+		inline double getSeekTime() const { return time_; }
+
+		// ݂̑Ŝ̍Đʒů 0 ` 1.0 ŕԂ
+		inline double getSeekRate() const { return (total_time_ > 0) ? time_ / total_time_ : 0; }
+
+		inline bool isPlaying() const { return seek_.isPlaying(); }
+		inline uint32_t getTrackNum() const { return static_cast<uint32_t>(tracks_.size()); }
+		inline uint32_t getEventNum() const { return static_cast<uint32_t>(event_times_.size()); }
+
+	private:
+		struct Track {
+			std::vector<float> times_;		// 
+			std::vector<float> values_;
+			float* target_ = nullptr;
+			float value_ = 0;
+			uint32_t cursor_ = 0;			// O]Ԃ̐擪L[
+			eInterp interp_ = eInterp::LINEAR;
+		};
+
+		static float evaluate(Track& track, const float time);
+		void fireEvents(const double from, const double to, const bool is_forward, const bool is_include_from);
+		void evaluateAll();
+
+		SeekUnit seek_;
+		std::vector<Track> tracks_;
+		std::vector<float> event_times_;	// 
+		std::vector<std::function<void()>> event_functions_;
+		double total_time_ = 0;
+		double time_ = 0;
+		bool is_include_start_ = false;		//  update ŊJnʒũCxgĂяo
+	};
+
+}
@@ -38,6 +38,7 @@ void gameMain(float delta_time) {
 	//
 	// Ԍo߂ł̃\bhĂяo
 	// 
+	// tips... ̃^C}[ꍇ update ܂Ƃ߂čs TimerWheel ̎gpĂ
 	//
 
 	template <class T>
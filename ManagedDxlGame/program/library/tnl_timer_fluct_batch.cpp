@@ -0,0 +1,180 @@
+#include <cmath>
+#include "tnl_simd.h"
+#include "tnl_timer_fluct_batch.h"
+
+namespace tnl {
+
+	namespace {
+		constexpr float FLUCT_PI = 3.14159265358979f;
+
+		// [ -/2, /2 ]  sin / cos ( eC[WJ 11  / 12  덷 1e-7 x )
+		inline float SinPoly(const float x) {
+			const float x2 = x * x;
+			return x * (1.0f + x2 * (-1.0f / 6.0f + x2 * (1.0f / 120.0f + x2 * (-1.0f / 5040.0f + x2 * (1.0f / 362880.0f + x2 * (-1.0f / 39916800.0f))))));
+		}
+		inline float CosPoly(const float x) {
+			const float x2 = x * x;
+			return 1.0f + x2 * (-0.5f + x2 * (1.0f / 24.0f + x2 * (-1.0f / 720.0f + x2 * (1.0f / 40320.0f + x2 * (-1.0f / 3628800.0f + x2 * (1.0f / 479001600.0f))))));
+		}
+
+		// sin(  * rate ) = cos(  * ( rate - 0.5 ) ) , cos(  * rate ) = -sin(  * ( rate - 0.5 ) )
+		template< eFluctCurve CURVE >
+		inline float Weight(const float rate) {
+			if constexpr (eFluctCurve::LINEAR == CURVE) return rate;
+			else if constexpr (eFluctCurve::ACCEL == CURVE) return rate * rate;
+			else if constexpr (eFluctCurve::BRAKE == CURVE) return rate * (2.0f - rate);
+			else if constexpr (eFluctCurve::SIN == CURVE) return CosPoly(FLUCT_PI * (rate - 0.5f));
+			else return -SinPoly(FLUCT_PI * (rate - 0.5f));
+		}
+
+		template< eFluctCurve CURVE >
+		constexpr bool IsTrigonometric() { return eFluctCurve::SIN == CURVE || eFluctCurve::COS == CURVE; }
+
+		// [v̐is ( sin / cos  TimerFluct  seqSin / seqCos Ɠ 0 ` 2 ň邽ߎ 2 )
+		template< eFluctCurve CURVE, bool IS_LOOP >
+		inline float Rate(const float clock, const float start_time, const float inv_time) {
+			float rate = (clock - start_time) * inv_time;
+			if constexpr (IS_LOOP) {
+				constexpr float PERIOD = IsTrigonometric<CURVE>() ? 2.0f : 1.0f;
+				if (rate > 8388608.0f) rate = 8388608.0f;
+				return rate - PERIOD * floorf(rate * (1.0f / PERIOD));
+			}
+			else return (rate < 1.0f) ? rate : 1.0f;
+		}
+
+		// is [ 1, 2 )  sin / cos  sin(  * rate ) = -sin(  * ( rate - 1 ) )  [ 0, 1 ) 狁߂
+		template< eFluctCurve CURVE, bool IS_LOOP >
+		inline float RateWeight(const float rate) {
+			if constexpr (IS_LOOP && IsTrigonometric<CURVE>()) return (rate < 1.0f) ? Weight<CURVE>(rate) : -Weight<CURVE>(rate - 1.0f);
+			else return Weight<CURVE>(rate);
+		}
+
+#if defined(TNL_SIMD_SSE)
+		inline __m128 SinPoly4(const __m128 x) {
+			const __m128 x2 = _mm_mul_ps(x, x);
+			__m128 p = _mm_set1_ps(-1.0f / 39916800.0f);
+			p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f / 362880.0f));
+			p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.0f / 5040.0f));
+			p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f / 120.0f));
+			p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.0f / 6.0f));
+			p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f));
+			return _mm_mul_ps(p, x);
+		}
+		inline __m128 CosPoly4(const __m128 x) {
+			const __m128 x2 = _mm_mul_ps(x, x);
+			__m128 p = _mm_set1_ps(1.0f / 479001600.0f);
+			p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.0f / 3628800.0f));
+			p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f / 40320.0f));
+			p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.0f / 720.0f));
+			p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f / 24.0f));
+			p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-0.5f));
+			return _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f));
+		}
+
+		template< eFluctCurve CURVE >
+		inline __m128 Weight4(const __m128 rate) {
+			if constexpr (eFluctCurve::LINEAR == CURVE) return rate;
+			else if constexpr (eFluctCurve::ACCEL == CURVE) return _mm_mul_ps(rate, rate);
+			else if constexpr (eFluctCurve::BRAKE == CURVE) return _mm_mul_ps(rate, _mm_sub_ps(_mm_set1_ps(2.0f), rate));
+			else {
+				const __m128 x = _mm_mul_ps(_mm_set1_ps(FLUCT_PI), _mm_sub_ps(rate, _mm_set1_ps(0.5f)));
+				if constexpr (eFluctCurve::SIN == CURVE) return CosPoly4(x);
+				else return _mm_sub_ps(_mm_setzero_ps(), SinPoly4(x));
+			}
+		}
+
+		// ؂̂ ( SSE2 ɂ floor ̂ 0 ւ̊ۂ߂␳ )
+		inline __m128 Floor4(const __m128 x) {
+			const __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+			return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, x), _mm_set1_ps(1.0f)));
+		}
+
+		template< eFluctCurve CURVE, bool IS_LOOP >
+		inline __m128 Rate4(const __m128 clock, const float* start_time, const float* inv_time) {
+			__m128 rate = _mm_mul_ps(_mm_sub_ps(clock, _mm_loadu_ps(start_time)), _mm_loadu_ps(inv_time));
+			if constexpr (IS_LOOP) {
+				constexpr float PERIOD = IsTrigonometric<CURVE>() ? 2.0f : 1.0f;
+				rate = _mm_min_ps(rate, _mm_set1_ps(8388608.0f));
+				return _mm_sub_ps(rate, _mm_mul_ps(_mm_set1_ps(PERIOD), Floor4(_mm_mul_ps(rate, _mm_set1_ps(1.0f / PERIOD)))));
+			}
+			else return _mm_min_ps(rate, _mm_set1_ps(1.0f));
+		}
+
+		template< eFluctCurve CURVE, bool IS_LOOP >
+		inline __m128 RateWeight4(const __m128 rate) {
+			if constexpr (IS_LOOP && IsTrigonometric<CURVE>()) {
+				const __m128 second = _mm_cmpge_ps(rate, _mm_set1_ps(1.0f));
+				const __m128 w = Weight4<CURVE>(_mm_sub_ps(rate, _mm_and_ps(second, _mm_set1_ps(1.0f))));
+				return _mm_xor_ps(w, _mm_and_ps(second, _mm_set1_ps(-0.0f)));
+			}
+			else return Weight4<CURVE>(rate);
+		}
+#endif
+
+		template< eFluctCurve CURVE, bool IS_LOOP >
+		void EvaluateCurve(const float clock, const float* start_time, const float* inv_time, float* weight, const uint32_t num) {
+			uint32_t n = 0;
+#if defined(TNL_SIMD_SSE)
+			const __m128 vclock = _mm_set1_ps(clock);
+			for (; n + 4 <= num; n += 4) {
+				_mm_storeu_ps(weight + n, RateWeight4<CURVE, IS_LOOP>(Rate4<CURVE, IS_LOOP>(vclock, start_time + n, inv_time + n)));
+			}
+#endif
+			// [ ( XJ[ł͑Svf )
+			for (; n < num; ++n) {
+				weight[n] = RateWeight<CURVE, IS_LOOP>(Rate<CURVE, IS_LOOP>(clock, start_time[n], inv_time[n]));
+			}
+		}
+
+		template< bool IS_LOOP >
+		void EvaluateLoop(const eFluctCurve curve, const float clock, const float* start_time, const float* inv_time, float* weight, const uint32_t num) {
+			switch (curve) {
+			case eFluctCurve::LINEAR: EvaluateCurve<eFluctCurve::LINEAR, IS_LOOP>(clock, start_time, inv_time, weight, num); break;
+			case eFluctCurve::ACCEL: EvaluateCurve<eFluctCurve::ACCEL, IS_LOOP>(clock, start_time, inv_time, weight, num); break;
+			case eFluctCurve::BRAKE: EvaluateCurve<eFluctCurve::BRAKE, IS_LOOP>(clock, start_time, inv_time, weight, num); break;
+			case eFluctCurve::SIN: EvaluateCurve<eFluctCurve::SIN, IS_LOOP>(clock, start_time, inv_time, weight, num); break;
+			case eFluctCurve::COS: EvaluateCurve<eFluctCurve::COS, IS_LOOP>(clock, start_time, inv_time, weight, num); break;
+			default: break;
+			}
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	float FluctBatchWeight(const eFluctCurve curve, const float rate) {
+		switch (curve) {
+		case eFluctCurve::LINEAR: return Weight<eFluctCurve::LINEAR>(rate);
+		case eFluctCurve::ACCEL: return Weight<eFluctCurve::ACCEL>(rate);
+		case eFluctCurve::BRAKE: return Weight<eFluctCurve::BRAKE>(rate);
+		case eFluctCurve::SIN: return Weight<eFluctCurve::SIN>(rate);
+		case eFluctCurve::COS: return Weight<eFluctCurve::COS>(rate);
+		default: return rate;
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void FluctBatchEvaluate(const eFluctCurve curve, const bool is_loop, const float clock, const float* start_time, const float* inv_time, const float* power, float* weight, const uint32_t num) {
+		if (is_loop) EvaluateLoop<true>(curve, clock, start_time, inv_time, weight, num);
+		else EvaluateLoop<false>(curve, clock, start_time, inv_time, weight, num);
+
+		// Op̏搔 1 ȊO̗vf̂݌ʂɌvZ
+		if (!power || (eFluctCurve::SIN != curve && eFluctCurve::COS != curve)) return;
+		for (uint32_t n = 0; n < num; ++n) {
+			if (1.0f != power[n]) weight[n] = powf(weight[n], power[n]);
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void FluctBatchBlend(const float* from, const float* delta, const float* weight, float* out, const uint32_t num) {
+		uint32_t n = 0;
+#if defined(TNL_SIMD_SSE)
+		for (; n + 4 <= num; n += 4) {
+			__m128 v = _mm_add_ps(_mm_loadu_ps(from + n), _mm_mul_ps(_mm_loadu_ps(delta + n), _mm_loadu_ps(weight + n)));
+			_mm_storeu_ps(out + n, v);
+		}
+#endif
+		for (; n < num; ++n) {
+			out[n] = from[n] + delta[n] * weight[n];
+		}
+	}
+
+}
@@ -0,0 +1,486 @@
+#pragma once
+#include <cstdint>
+#include <cmath>
+#include <cfloat>
+#include <cstring>
+#include <vector>
+#include <type_traits>
+
+namespace tnl {
+
+/*
+//
+//  gp@Tv
+//
+
+tnl::TimerFluctBatch<tnl::Vector3> g_fluct;
+
+void gameMain(float deltatime) {
+
+	if (tnl::Input::IsKeyDownTrigger(eKeys::KB_Z)) {
+		// ʒ 1 bČȂL ( l̓ob`ɕێ )
+		for (uint32_t i = 0; i < 1000; ++i) {
+			tnl::Vector3 goal = tnl::Vector3(640, 360, 0) + tnl::Vector3(cosf(i * 0.1f), sinf(i * 0.1f), 0) * 300.0f;
+			g_fluct.addBrake({ 640, 360, 0 }, goal, tnl::Vector3::Normalize(goal - tnl::Vector3(640, 360, 0)), 300.0f, 1.0f, i);
+		}
+	}
+
+	g_fluct.update(deltatime);
+
+	// ̂̓CxgŒʒm
+	for (const auto& e : g_fluct.getEvents()) {
+		// e.tag_ ɓo^̒l
+	}
+}
+
+*/
+
+	//------------------------------------------------------------------------------------------------------------
+	// lϓ̎ ( TimerFluct  setMethod*** ɑΉ )
+	enum class eFluctCurve {
+		LINEAR,		// ^
+		ACCEL,		// ^
+		BRAKE,		// ^
+		SIN,		// sing 0 ` ΂̉^
+		COS,		// cosg 0 ` ΂̉^
+		MAX
+	};
+
+	//------------------------------------------------------------------------------------------------------------
+	// is ( 0 ` 1 ) ɑ΂ω
+	// tips... SIN / COS ̏搔͊܂݂܂
+	float FluctBatchWeight(const eFluctCurve curve, const float rate);
+
+	//------------------------------------------------------------------------------------------------------------
+	// ω̈ꊇvZ
+	// arg1... ϓ̎
+	// arg2... [ true : is 0 ` 1 ŌJԂ ] [ false : 1 Ŏ~߂ ]
+	//         SIN / COS ̌JԂ TimerFluct Ɠ 0 ` 2 ň܂ ( 㔼͕̒l )
+	// arg3... ݎ
+	// arg4... Jn̔z
+	// arg5... Ԃ̋t̔z
+	// arg6... Op̏搔̔z ( SIN / COS ȊO nullptr  )
+	// arg7... ω̏o͐
+	// arg8... vf
+	void FluctBatchEvaluate(const eFluctCurve curve, const bool is_loop, const float clock, const float* start_time, const float* inv_time, const float* power, float* weight, const uint32_t num);
+
+	//------------------------------------------------------------------------------------------------------------
+	// out[i] = from[i] + delta[i] * weight[i] ̈ꊇvZ
+	void FluctBatchBlend(const float* from, const float* delta, const float* weight, float* out, const uint32_t num);
+
+
+	//------------------------------------------------------------------------------------------------------------
+	//
+	// ̐lϓ܂Ƃ߂ď TimerFluct
+	//
+	// T [ float ō\ꂽ^ ( float, Vector3  ) ]
+	// tips... ϓ̎ނƂɑSĂ̕ϓ𐬕Ƃ̔z ( SoA ) ŕێA
+	//         ωƒl SIMD ł܂Ƃ߂ČvZ܂
+	//         ϓƂ Sequence |C^݂̂ŁA̕ϓłׂ̕ōXVł܂
+	//         vZʂ getValue Ŏ擾܂AϓCX^Xւ̃|C^nēo^ꍇ
+	//         TimerFluct Ɠl update ̓xɂ̃CX^Xւ݂܂
+	//         ϓ update  getEvents Ŏ擾łAnh͖ɂȂ܂
+	//         TimerFluct ƈقȂAJnl͓o^̒lŌoߎԂ͂ update  delta_time ܂߂ČvZ܂
+	//         SIN / COS  is_loop w肵Ȃ芮ԂŊ܂
+	//
+	template< class T >
+	class TimerFluctBatch final {
+		static_assert(std::is_trivially_copyable<T>::value && 0 == sizeof(T) % sizeof(float), "T must consist of float");
+	public:
+		// ϓ̃nh (  20 bit CfbNXA 12 bit  )
+		using Handle = uint32_t;
+		static constexpr Handle INVALID_HANDLE = 0xffffffff;
+
+		// ̒ʒm
+		struct Event {
+			Handle		handle_;	// ϓ̃nh
+			uint32_t	tag_;		// o^Ɏw肵l
+		};
+
+		TimerFluctBatch() {}
+		TimerFluctBatch(const TimerFluctBatch&) = delete;
+		TimerFluctBatch& operator=(const TimerFluctBatch&) = delete;
+
+		//==============================================================================================================
+		// ^o^
+		// arg1... ϓCX^Xւ̃|C^ ܂ Jnl
+		// arg2... l
+		// arg3...  (b)
+		// arg4... CxgŒʒml ȗ
+		//==============================================================================================================
+		inline Handle addLinear(T* origin, const T& complete, const float complete_time, const uint32_t tag = 0) {
+			return addLinear(*origin, complete, complete_time, tag, origin);
+		}
+		inline Handle addLinear(const T& start, const T& complete, const float complete_time, const uint32_t tag = 0) {
+			return addLinear(start, complete, complete_time, tag, nullptr);
+		}
+
+		//==============================================================================================================
+		// ^o^
+		// arg1... ϓCX^Xւ̃|C^ ܂ Jnl
+		// arg2... l
+		// arg3... arg1 -> arg2 ւ̐Kl
+		// arg4... arg1 -> arg2 ւ̋
+		// arg5...  (b)
+		// arg6... CxgŒʒml ȗ
+		//==============================================================================================================
+		inline Handle addAccel(T* origin, const T& complete, const T& to_complete_normalize, const float distance, const float complete_time, const uint32_t tag = 0) {
+			return addAccelBrake(eFluctCurve::ACCEL, *origin, complete, to_complete_normalize, distance, complete_time, tag, origin);
+		}
+		inline Handle addAccel(const T& start, const T& complete, const T& to_complete_normalize, const float distance, const float complete_time, const uint32_t tag = 0) {
+			return addAccelBrake(eFluctCurve::ACCEL, start, complete, to_complete_normalize, distance, complete_time, tag, nullptr);
+		}
+
+		//==============================================================================================================
+		// ^o^
+		// arg1... ϓCX^Xւ̃|C^ ܂ Jnl
+		// arg2... l
+		// arg3... arg1 -> arg2 ւ̐Kl
+		// arg4... arg1 -> arg2 ̋
+		// arg5...  (b)
+		// arg6... CxgŒʒml ȗ
+		//==============================================================================================================
+		inline Handle addBrake(T* origin, const T& complete, const T& to_complete_normalize, const float distance, const float complete_time, const uint32_t tag = 0) {
+			return addAccelBrake(eFluctCurve::BRAKE, *origin, complete, to_complete_normalize, distance, complete_time, tag, origin);
+		}
+		inline Handle addBrake(const T& start, const T& complete, const T& to_complete_normalize, const float distance, const float complete_time, const uint32_t tag = 0) {
+			return addAccelBrake(eFluctCurve::BRAKE, start, complete, to_complete_normalize, distance, complete_time, tag, nullptr);
+		}
+
+		//==============================================================================================================
+		// sing 0 ` ΂̉^o^
+		// arg1... ϓCX^Xւ̃|C^ ܂ Jnl
+		// arg2... l
+		// arg3...  (b)
+		// arg4... Op̏搔 ȗ
+		// arg5... ɌJԂꍇ true ȗ
+		// arg6... CxgŒʒml ȗ
+		//==============================================================================================================
+		inline Handle addSin(T* origin, const T& complete, const float complete_time, const float trigonometric_power = 1.0f, const bool is_loop = false, const uint32_t tag = 0) {
+			return addTrigonometric(eFluctCurve::SIN, *origin, complete, complete_time, trigonometric_power, is_loop, tag, origin);
+		}
+		inline Handle addSin(const T& start, const T& complete, const float complete_time, const float trigonometric_power = 1.0f, const bool is_loop = false, const uint32_t tag = 0) {
+			return addTrigonometric(eFluctCurve::SIN, start, complete, complete_time, trigonometric_power, is_loop, tag, nullptr);
+		}
+
+		//==============================================================================================================
+		// cosg 0 ` ΂̉^o^
+		// arg1... ϓCX^Xւ̃|C^ ܂ Jnl
+		// arg2... l
+		// arg3...  (b)
+		// arg4... Op̏搔 ȗ
+		// arg5... ɌJԂꍇ true ȗ
+		// arg6... CxgŒʒml ȗ
+		//==============================================================================================================
+		inline Handle addCos(T* origin, const T& complete, const float complete_time, const float trigonometric_power = 1.0f, const bool is_loop = false, const uint32_t tag = 0) {
+			return addTrigonometric(eFluctCurve::COS, *origin, complete, complete_time, trigonometric_power, is_loop, tag, origin);
+		}
+		inline Handle addCos(const T& start, const T& complete, const float complete_time, const float trigonometric_power = 1.0f, const bool is_loop = false, const uint32_t tag = 0) {
+			return addTrigonometric(eFluctCurve::COS, start, complete, complete_time, trigonometric_power, is_loop, tag, nullptr);
+		}
+
+		//==============================================================================================================
+		// lϓ̍XV
+		// arg1... t[Ԃ̃f^^C
+		// tips... O update ŔCxg̓NA܂
+		//==============================================================================================================
+		void update(const float deltatime) {
+			events_.clear();
+			clock_ += deltatime;
+			if (clock_ >= REBASE_TIME) rebase();
+
+			for (uint32_t b = 0; b < BUCKET_NUM; ++b) {
+				Bucket& bucket = buckets_[b];
+				const uint32_t num = static_cast<uint32_t>(bucket.slot_.size());
+				if (0 == num) continue;
+				const eFluctCurve curve = static_cast<eFluctCurve>(b >> 1);
+				const bool is_loop = (0 != (b & 1));
+
+				if (weight_.size() < num) weight_.resize(num);
+				FluctBatchEvaluate(curve, is_loop, clock_, bucket.start_time_.data(), bucket.inv_time_.data(), bucket.power_.data(), weight_.data(), num);
+				for (uint32_t c = 0; c < COMPONENT_NUM; ++c) {
+					FluctBatchBlend(bucket.from_[c].data(), bucket.delta_[c].data(), weight_.data(), bucket.value_[c].data(), num);
+				}
+
+				// |C^wœo^ꂽ̂֏
+				if (bucket.origin_num_ > 0) {
+					for (uint32_t i = 0; i < num; ++i) {
+						if (bucket.origin_[i]) writeOrigin(bucket, i, bucket.value_);
+					}
+				}
+
+				if (!is_loop && clock_ >= bucket.end_time_min_) complete(b);
+			}
+		}
+
+		//==============================================================================================================
+		// Cxg̈ꗗ ( O update Ŋ )
+		//==============================================================================================================
+		inline const std::vector<Event>& getEvents() const noexcept { return events_; }
+
+		//==============================================================================================================
+		// ݒl̎擾
+		// arg1... nh
+		// arg2... ݒl̎󂯎p
+		// ret.... [ true : 擾 ] [ false : ς݂܂͉ς ]
+		//==============================================================================================================
+		bool getValue(const Handle handle, T& out) const {
+			if (!isActive(handle)) return false;
+			const Slot& slot = slots_[handle & INDEX_MASK];
+			float v[COMPONENT_NUM];
+			for (uint32_t c = 0; c < COMPONENT_NUM; ++c) v[c] = buckets_[slot.bucket_].value_[c][slot.index_];
+			memcpy(&out, v, sizeof(T));
+			return true;
+		}
+
+		//==============================================================================================================
+		// Lȃnh ( EĂȂ )
+		//==============================================================================================================
+		inline bool isActive(const Handle handle) const noexcept {
+			const uint32_t index = handle & INDEX_MASK;
+			return INVALID_HANDLE != handle && index < slots_.size() && NIL != slots_[index].index_ && slots_[index].generation_ == (handle >> INDEX_BITS);
+		}
+
+		//==============================================================================================================
+		// ϓ̉ ( l͂̎_̂܂ )
+		// ret.... [ true :  ] [ false : ς݂܂͉ς ]
+		//==============================================================================================================
+		bool cancel(const Handle handle) {
+			if (!isActive(handle)) return false;
+			const Slot& slot = slots_[handle & INDEX_MASK];
+			remove(slot.bucket_, slot.index_);
+			return true;
+		}
+
+		//==============================================================================================================
+		// Sϓ̉
+		//==============================================================================================================
+		void clear() {
+			for (uint32_t b = 0; b < BUCKET_NUM; ++b) {
+				while (!buckets_[b].slot_.empty()) remove(b, static_cast<uint32_t>(buckets_[b].slot_.size()) - 1);
+			}
+			events_.clear();
+		}
+
+		//==============================================================================================================
+		// ϓ̐
+		//==============================================================================================================
+		inline uint32_t getSize() const noexcept { return size_; }
+
+		//==============================================================================================================
+		// w萔̕ϓo^ł悤nḧ̗m
+		//==============================================================================================================
+		inline void reserve(const uint32_t num) {
+			slots_.reserve(num);
+			weight_.reserve(num);
+		}
+
+	private:
+		static constexpr uint32_t COMPONENT_NUM = sizeof(T) / sizeof(float);
+		static constexpr uint32_t BUCKET_NUM = static_cast<uint32_t>(eFluctCurve::MAX) * 2;
+		static constexpr uint32_t INDEX_BITS = 20;
+		static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+		static constexpr uint32_t GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+		static constexpr uint32_t NIL = 0xffffffff;
+		//  float ŕێ̂ŁAxȂ悤莞ԂƂ 0 ֖߂
+		static constexpr float REBASE_TIME = 256.0f;
+
+		// ϓ̎ ( ƌJԂ̗L ) Ƃ SoA
+		struct Bucket {
+			std::vector<float> start_time_;
+			std::vector<float> end_time_;
+			std::vector<float> inv_time_;
+			std::vector<float> power_;
+			std::vector<float> from_[COMPONENT_NUM];
+			std::vector<float> delta_[COMPONENT_NUM];
+			std::vector<float> complete_[COMPONENT_NUM];
+			std::vector<float> value_[COMPONENT_NUM];
+			std::vector<T*> origin_;
+			std::vector<uint32_t> tag_;
+			std::vector<uint32_t> slot_;
+			uint32_t origin_num_ = 0;
+			float end_time_min_ = FLT_MAX;
+		};
+
+		struct Slot {
+			uint32_t bucket_;
+			uint32_t index_;		// oPbg̈ʒu ( gp̏ꍇ NIL )
+			uint32_t generation_;
+			uint32_t next_free_;
+		};
+
+		Handle addLinear(const T& start, const T& complete, const float complete_time, const uint32_t tag, T* origin) {
+			float s[COMPONENT_NUM], e[COMPONENT_NUM], d[COMPONENT_NUM];
+			memcpy(s, &start, sizeof(T));
+			memcpy(e, &complete, sizeof(T));
+			for (uint32_t c = 0; c < COMPONENT_NUM; ++c) d[c] = e[c] - s[c];
+			return add(eFluctCurve::LINEAR, false, s, d, e, complete_time, 1.0f, tag, origin);
+		}
+
+		Handle addAccelBrake(const eFluctCurve curve, const T& start, const T& complete, const T& to_complete_normalize, const float distance, const float complete_time, const uint32_t tag, T* origin) {
+			float s[COMPONENT_NUM], e[COMPONENT_NUM], d[COMPONENT_NUM];
+			memcpy(s, &start, sizeof(T));
+			memcpy(e, &complete, sizeof(T));
+			memcpy(d, &to_complete_normalize, sizeof(T));
+			for (uint32_t c = 0; c < COMPONENT_NUM; ++c) d[c] *= distance;
+			// ͊ltZʒuɂ ( complete - vn * distance * ( 1 - t )^2 )
+			if (eFluctCurve::BRAKE == curve) {
+				for (uint32_t c = 0; c < COMPONENT_NUM; ++c) s[c] = e[c] - d[c];
+			}
+			return add(curve, false, s, d, e, complete_time, 1.0f, tag, origin);
+		}
+
+		Handle addTrigonometric(const eFluctCurve curve, const T& start, const T& complete, const float complete_time, const float power, const bool is_loop, const uint32_t tag, T* origin) {
+			float s[COMPONENT_NUM], e[COMPONENT_NUM], d[COMPONENT_NUM];
+			memcpy(s, &start, sizeof(T));
+			memcpy(e, &complete, sizeof(T));
+			for (uint32_t c = 0; c < COMPONENT_NUM; ++c) d[c] = e[c] - s[c];
+			// ̒l͐is 1 ̒l
+			float w = FluctBatchWeight(curve, 1.0f);
+			if (1.0f != power) w = powf(w, power);
+			for (uint32_t c = 0; c < COMPONENT_NUM; ++c) e[c] = s[c] + d[c] * w;
+			return add(curve, is_loop, s, d, e, complete_time, power, tag, origin);
+		}
+
+		Handle add(const eFluctCurve curve, const bool is_loop, const float* from, const float* delta, const float* complete, const float complete_time, const float power, const uint32_t tag, T* origin) {
+			uint32_t id = free_;
+			if (NIL != id) free_ = slots_[id].next_free_;
+			else {
+				if (slots_.size() >= INDEX_MASK) return INVALID_HANDLE;
+				id = static_cast<uint32_t>(slots_.size());
+				slots_.push_back({ 0, NIL, 0, NIL });
+			}
+			const uint32_t b = static_cast<uint32_t>(curve) * 2 + (is_loop ? 1 : 0);
+			Bucket& bucket = buckets_[b];
+			const float time = (complete_time > FLT_EPSILON) ? complete_time : FLT_EPSILON;
+			const float end_time = clock_ + time;
+			bucket.start_time_.emplace_back(clock_);
+			bucket.end_time_.emplace_back(end_time);
+			bucket.inv_time_.emplace_back(1.0f / time);
+			bucket.power_.emplace_back(power);
+			for (uint32_t c = 0; c < COMPONENT_NUM; ++c) {
+				bucket.from_[c].emplace_back(from[c]);
+				bucket.delta_[c].emplace_back(delta[c]);
+				bucket.complete_[c].emplace_back(complete[c]);
+				bucket.value_[c].emplace_back(from[c]);
+			}
+			bucket.origin_.emplace_back(origin);
+			bucket.tag_.emplace_back(tag);
+			bucket.slot_.emplace_back(id);
+			if (origin) ++bucket.origin_num_;
+			if (!is_loop && end_time < bucket.end_time_min_) bucket.end_time_min_ = end_time;
+
+			Slot& slot = slots_[id];
+			slot.bucket_ = b;
+			slot.index_ = static_cast<uint32_t>(bucket.slot_.size()) - 1;
+			++size_;
+			return id | (slot.generation_ << INDEX_BITS);
+		}
+
+		// ̗vfƓւč폜
+		void remove(const uint32_t b, const uint32_t index) {
+			Bucket& bucket = buckets_[b];
+			const uint32_t last = static_cast<uint32_t>(bucket.slot_.size()) - 1;
+			const uint32_t id = bucket.slot_[index];
+			if (bucket.origin_[index]) --bucket.origin_num_;
+			if (index != last) {
+				bucket.start_time_[index] = bucket.start_time_[last];
+				bucket.end_time_[index] = bucket.end_time_[last];
+				bucket.inv_time_[index] = bucket.inv_time_[last];
+				bucket.power_[index] = bucket.power_[last];
+				for (uint32_t c = 0; c < COMPONENT_NUM; ++c) {
+					bucket.from_[c][index] = bucket.from_[c][last];
+					bucket.delta_[c][index] = bucket.delta_[c][last];
+					bucket.complete_[c][index] = bucket.complete_[c][last];
+					bucket.value_[c][index] = bucket.value_[c][last];
+				}
+				bucket.origin_[index] = bucket.origin_[last];
+				bucket.tag_[index] = bucket.tag_[last];
+				bucket.slot_[index] = bucket.slot_[last];
+				slots_[bucket.slot_[index]].index_ = index;
+			}
+			bucket.start_time_.pop_back();
+			bucket.end_time_.pop_back();
+			bucket.inv_time_.pop_back();
+			bucket.power_.pop_back();
+			for (uint32_t c = 0; c < COMPONENT_NUM; ++c) {
+				bucket.from_[c].pop_back();
+				bucket.delta_[c].pop_back();
+				bucket.complete_[c].pop_back();
+				bucket.value_[c].pop_back();
+			}
+			bucket.origin_.pop_back();
+			bucket.tag_.pop_back();
+			bucket.slot_.pop_back();
+			if (bucket.slot_.empty()) bucket.end_time_min_ = FLT_MAX;
+
+			Slot& slot = slots_[id];
+			slot.index_ = NIL;
+			slot.generation_ = (slot.generation_ + 1) & GENERATION_MASK;
+			slot.next_free_ = free_;
+			free_ = id;
+			--size_;
+		}
+
+		// Ԃ߂̂lɂăCxg𔭍s
+		void complete(const uint32_t b) {
+			Bucket& bucket = buckets_[b];
+			float end_time_min = FLT_MAX;
+			for (uint32_t i = static_cast<uint32_t>(bucket.slot_.size()); i > 0; --i) {
+				const uint32_t index = i - 1;
+				if (clock_ < bucket.end_time_[index]) {
+					if (bucket.end_time_[index] < end_time_min) end_time_min = bucket.end_time_[index];
+					continue;
+				}
+				if (bucket.origin_[index]) writeOrigin(bucket, index, bucket.complete_);
+				const uint32_t id = bucket.slot_[index];
+				events_.push_back({ id | (slots_[id].generation_ << INDEX_BITS), bucket.tag_[index] });
+				// 瑖Ă̂œւŗ̂͊mFς݂̗vf
+				remove(b, index);
+			}
+			bucket.end_time_min_ = end_time_min;
+		}
+
+		inline void writeOrigin(const Bucket& bucket, const uint32_t index, const std::vector<float> (&values)[COMPONENT_NUM]) {
+			float v[COMPONENT_NUM];
+			for (uint32_t c = 0; c < COMPONENT_NUM; ++c) v[c] = values[c][index];
+			memcpy(bucket.origin_[index], v, sizeof(T));
+		}
+
+		void rebase() {
+			const float base = clock_;
+			for (uint32_t b = 0; b < BUCKET_NUM; ++b) {
+				Bucket& bucket = buckets_[b];
+				for (float& t : bucket.end_time_) t -= base;
+				if (FLT_MAX != bucket.end_time_min_) bucket.end_time_min_ -= base;
+				if (0 == (b & 1)) {
+					for (float& t : bucket.start_time_) t -= base;
+					continue;
+				}
+
+				// [v̂͊Jn̐{i߂ČoߎԂ 1 ɖ߂
+				// ( ߂ȂƊJn֐LёĐis̐xAŌ͏Ŏ~܂ )
+				// ߂ʂ̊ۂߌ덷񓯂ɗ܂ĈʑȂ悤A double ŌvZ
+				const eFluctCurve curve = static_cast<eFluctCurve>(b >> 1);
+				const double period = (eFluctCurve::SIN == curve || eFluctCurve::COS == curve) ? 2.0 : 1.0;
+				const uint32_t num = static_cast<uint32_t>(bucket.start_time_.size());
+				for (uint32_t i = 0; i < num; ++i) {
+					const double inv_time = bucket.inv_time_[i];
+					const double start_time = static_cast<double>(bucket.start_time_[i]) - base;
+					const double loop = floor(-start_time * inv_time / period);
+					bucket.start_time_[i] = static_cast<float>((loop > 0) ? start_time + loop * period / inv_time : start_time);
+				}
+			}
+			clock_ = 0;
+		}
+
+		Bucket buckets_[BUCKET_NUM];
+		std::vector<Slot> slots_;
+		std::vector<float> weight_;
+		std::vector<Event> events_;
+		uint32_t free_ = NIL;
+		uint32_t size_ = 0;
+		float clock_ = 0;
+	};
+
+}
@@ -0,0 +1,230 @@
+#include <bit>
+#include "tnl_timer_wheel.h"
+
+namespace tnl {
+
+	//-----------------------------------------------------------------------------------------------------
+	TimerWheel::TimerWheel(const float resolution) {
+		resolution_ = (resolution > 0) ? static_cast<double>(resolution) : 0.001;
+		for (uint32_t& head : heads_) head = NIL;
+		for (uint64_t& bits : occupied_) bits = 0;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	TimerWheel::Handle TimerWheel::registFunction(std::function<void(const float)> func, const float regulation_time, const bool is_callback_start) {
+		uint32_t index = free_;
+		if (NIL != index) {
+			free_ = nodes_[index].next_;
+		}
+		else {
+			if (nodes_.size() >= INDEX_MASK) return INVALID_HANDLE;
+			index = static_cast<uint32_t>(nodes_.size());
+			nodes_.push_back({ 0, 0, NIL, NIL, LIST_FREE, 0 });
+			functions_.emplace_back();
+		}
+		functions_[index] = std::move(func);
+
+		Node& node = nodes_[index];
+		double interval = static_cast<double>(regulation_time) / resolution_ + 0.5;
+		node.interval_ = (interval >= 1.0) ? static_cast<uint64_t>(interval) : 1;
+		node.deadline_ = (is_callback_start) ? now_ : now_ + node.interval_;
+		++size_;
+		const Handle handle = index | (node.generation_ << INDEX_BITS);
+		if (is_callback_start) {
+			node.list_ = LIST_BEHIND;
+			behind_.emplace_back(handle);
+		}
+		else link(index, node.deadline_);
+		return handle;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	bool TimerWheel::cancel(const Handle handle) {
+		if (!isActive(handle)) return false;
+		release(handle & INDEX_MASK);
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void TimerWheel::clear() {
+		for (uint32_t i = 0; i < nodes_.size(); ++i) {
+			if (LIST_FREE != nodes_[i].list_) release(i);
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	float TimerWheel::getRemainTime(const Handle handle) const noexcept {
+		if (!isActive(handle)) return 0;
+		const Node& node = nodes_[handle & INDEX_MASK];
+		if (node.deadline_ <= now_) return 0;
+		double remain = static_cast<double>(node.deadline_ - now_) * resolution_ - remain_;
+		return (remain > 0) ? static_cast<float>(remain) : 0;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void TimerWheel::reserve(const uint32_t num) {
+		nodes_.reserve(num);
+		functions_.reserve(num);
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void TimerWheel::update(const float delta_time) {
+		delta_time_ = delta_time;
+		remain_ += static_cast<double>(delta_time);
+		uint64_t ticks = (remain_ > 0) ? static_cast<uint64_t>(remain_ / resolution_) : 0;
+		remain_ -= static_cast<double>(ticks) * resolution_;
+		target_ = now_ + ticks;
+
+		// O܂łɒxꂽ^C}[͌oߎԂɊւ炸Ăяo
+		fire_.swap(behind_);
+		for (const Handle handle : fire_) {
+			if (!isActive(handle) || LIST_BEHIND != nodes_[handle & INDEX_MASK].list_) continue;
+			nodes_[handle & INDEX_MASK].list_ = LIST_FIRE;
+			fire(handle);
+		}
+		fire_.clear();
+
+		while (now_ < target_) {
+			// ݂ 256 tick ̋ԓ͋łȂXbg܂œǂݔ΂
+			uint64_t last = now_ | SLOT_MASK;
+			if (last > target_) last = target_;
+			uint32_t slot = 0;
+			if (now_ < last && findOccupied(static_cast<uint32_t>(now_ + 1) & SLOT_MASK, static_cast<uint32_t>(last) & SLOT_MASK, slot)) {
+				now_ = (now_ & ~static_cast<uint64_t>(SLOT_MASK)) | slot;
+				fireSlot(slot);
+				continue;
+			}
+			now_ = last;
+			if (now_ == target_) break;
+
+			// Ԃ̋Eł͏̒i珇ɉ̒i֐U蕪
+			++now_;
+			for (uint32_t level = LEVEL_NUM - 1; level > 0; --level) {
+				if (0 == (now_ & ((1ull << (SLOT_BITS * level)) - 1))) cascade(level);
+			}
+			if (occupied_[0] & 1) fireSlot(0);
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void TimerWheel::link(const uint32_t index, uint64_t expire) {
+		Node& node = nodes_[index];
+		if (expire < now_) expire = now_;
+		const uint64_t delta = expire - now_;
+		uint32_t slot = 0;
+		if (delta < SLOT_NUM) {
+			slot = static_cast<uint32_t>(expire) & SLOT_MASK;
+			occupied_[slot >> 6] |= 1ull << (slot & 63);
+		}
+		else {
+			uint32_t level = 1;
+			while (level < LEVEL_NUM - 1 && delta >= (1ull << (SLOT_BITS * (level + 1)))) ++level;
+			// ͈͊O͍ŏi̍łXbgőҋ@AU蕪̍ۂɍČvZ
+			if (delta >= (1ull << (SLOT_BITS * LEVEL_NUM))) expire = now_ + (1ull << (SLOT_BITS * LEVEL_NUM)) - 1;
+			slot = level * SLOT_NUM + (static_cast<uint32_t>(expire >> (SLOT_BITS * level)) & SLOT_MASK);
+		}
+		node.prev_ = NIL;
+		node.next_ = heads_[slot];
+		if (NIL != node.next_) nodes_[node.next_].prev_ = index;
+		heads_[slot] = index;
+		node.list_ = slot;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void TimerWheel::unlink(const uint32_t index) {
+		Node& node = nodes_[index];
+		if (node.list_ >= LIST_FREE) return;
+		if (NIL != node.prev_) nodes_[node.prev_].next_ = node.next_;
+		else {
+			heads_[node.list_] = node.next_;
+			if (NIL == node.next_ && node.list_ < SLOT_NUM) occupied_[node.list_ >> 6] &= ~(1ull << (node.list_ & 63));
+		}
+		if (NIL != node.next_) nodes_[node.next_].prev_ = node.prev_;
+		node.prev_ = NIL;
+		node.next_ = NIL;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void TimerWheel::release(const uint32_t index) {
+		unlink(index);
+		Node& node = nodes_[index];
+		functions_[index] = nullptr;
+		node.generation_ = (node.generation_ + 1) & GENERATION_MASK;
+		node.list_ = LIST_FREE;
+		node.next_ = free_;
+		free_ = index;
+		--size_;
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void TimerWheel::cascade(const uint32_t level) {
+		const uint32_t slot = level * SLOT_NUM + (static_cast<uint32_t>(now_ >> (SLOT_BITS * level)) & SLOT_MASK);
+		uint32_t index = heads_[slot];
+		heads_[slot] = NIL;
+		while (NIL != index) {
+			const uint32_t next = nodes_[index].next_;
+			link(index, nodes_[index].deadline_);
+			index = next;
+		}
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void TimerWheel::fireSlot(const uint32_t slot) {
+		uint32_t index = heads_[slot];
+		heads_[slot] = NIL;
+		occupied_[slot >> 6] &= ~(1ull << (slot & 63));
+		fire_.clear();
+		while (NIL != index) {
+			Node& node = nodes_[index];
+			node.list_ = LIST_FIRE;
+			fire_.emplace_back(index | (node.generation_ << INDEX_BITS));
+			index = node.next_;
+		}
+
+		for (size_t i = 0; i < fire_.size(); ++i) {
+			if (isActive(fire_[i]) && LIST_FIRE == nodes_[fire_[i] & INDEX_MASK].list_) fire(fire_[i]);
+		}
+		fire_.clear();
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void TimerWheel::fire(const Handle handle) {
+		const uint32_t index = handle & INDEX_MASK;
+		Node& node = nodes_[index];
+		if (node.deadline_ > now_) {
+			link(index, node.deadline_);
+			return;
+		}
+
+		// ̌Ăяoɓo^Ă ( R[obNł̉ɑΉ邽 )
+		// xꂪK莞ԈȏɂȂꍇ͎ update ŌĂяo
+		node.deadline_ += node.interval_;
+		if (node.deadline_ > target_) link(index, node.deadline_);
+		else {
+			node.list_ = LIST_BEHIND;
+			behind_.emplace_back(handle);
+		}
+
+		// R[obNł̓o^EŔz񂪕ωĂǂ悤oČĂяo
+		std::function<void(const float)> func = std::move(functions_[index]);
+		func(delta_time_);
+		if (isActive(handle)) functions_[index] = std::move(func);
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	bool TimerWheel::findOccupied(const uint32_t first, const uint32_t last, uint32_t& out) const noexcept {
+		uint32_t word = first >> 6;
+		const uint32_t last_word = last >> 6;
+		uint64_t bits = occupied_[word] & (~0ull << (first & 63));
+		for (;;) {
+			if (word == last_word) bits &= ~0ull >> (63 - (last & 63));
+			if (bits) {
+				out = (word << 6) | static_cast<uint32_t>(std::countr_zero(bits));
+				return true;
+			}
+			if (word == last_word) return false;
+			bits = occupied_[++word];
+		}
+	}
+
+}
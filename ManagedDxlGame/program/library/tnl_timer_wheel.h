@@ -0,0 +1,196 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <functional>
+
+namespace tnl {
+
+	/*
+
+//
+//  gp@Tv
+//
+
+
+class Test {
+public :
+	Test() {
+		timer_ = tnl::TimerWheel::GetCentral().regist(this, &Test::call, 1.0f);
+	}
+	~Test() {
+		tnl::TimerWheel::GetCentral().cancel(timer_);
+	}
+	uint32_t count = 0;
+	tnl::TimerWheel::Handle timer_;
+
+	void call(const float time);
+};
+
+void Test::call(const float time) {
+	count++;
+}
+
+Test test;
+
+void gameMain(float delta_time) {
+
+	// o^ꂽ^C}[SĂXV ( 1 t[ 1  )
+	tnl::TimerWheel::GetCentral().update(delta_time);
+
+	DrawStringEx(100, 100, -1, "%d", test.count );
+
+}
+
+	*/
+
+	//------------------------------------------------------------------------------------------------------------
+	//
+	// Kw^C}[zC[ɂ鎞Ԍo߂ł̃\bhĂяo
+	//
+	// tips... TimerCallback Ɠ ( IuWFNg, \bh, K莞 ) œo^Aupdate 1 őS^C}[܂
+	//         ^C}[͊̎Ƃ̃XbgɐU蕪̂ŁAupdate ׂ̕
+	//         o^ł͂Ȃ̃t[ŃR[obNĂяo^C}[̐ɔႵ܂
+	//          resolution bPʂɊۂ߂܂ ( K莞Ԃ̍ŏl resolution )
+	//         TimerCallback Ɠl 1  update  1 ̃^C}[Ă΂͍̂ő 1 ŁA
+	//         xꂽ͎̃t[ȍ~Ɏz܂
+	//         o^IuWFNgjꍇ́A cancel Ń^C}[Ă
+	//
+	class TimerWheel final {
+	public:
+		// ^C}[̃nh (  20 bit CfbNXA 12 bit  )
+		using Handle = uint32_t;
+		static constexpr Handle INVALID_HANDLE = 0xffffffff;
+
+		//===================================================================================
+		// RXgN^
+		// arg1... ̕\ ( bw ȗ 1 ~b )
+		//===================================================================================
+		explicit TimerWheel(const float resolution = 0.001f);
+		TimerWheel(const TimerWheel&) = delete;
+		TimerWheel& operator=(const TimerWheel&) = delete;
+
+		//===================================================================================
+		// ^C}[̓o^
+		// arg1... ܃NX this |C^w
+		// arg2... R[obNŌĂяo܃NX̃o\bh܂̓_w
+		// arg3... R[obNĂяőK莞( bw 1.0f 1b )
+		// arg4... ̃R[obN̂ݎ update őĂяo true w  ȗ
+		// ret.... Ɏgpnh
+		//===================================================================================
+		template< class T >
+		Handle regist(T* obj, void (T::* func)(const float), const float regulation_time, const bool is_callback_start = false) {
+			return registFunction([obj, func](const float delta_time) { (obj->*func)(delta_time); }, regulation_time, is_callback_start);
+		}
+		template< class T >
+		Handle regist(T* obj, const std::function<void(T*, const float)>& func, const float regulation_time, const bool is_callback_start = false) {
+			return registFunction([obj, func](const float delta_time) { func(obj, delta_time); }, regulation_time, is_callback_start);
+		}
+		Handle regist(const std::function<void(const float)>& func, const float regulation_time, const bool is_callback_start = false) {
+			return registFunction(func, regulation_time, is_callback_start);
+		}
+
+		//===================================================================================
+		// ^C}[̉
+		// arg1... regist Ŏ擾nh
+		// ret.... [ true :  ] [ false : ɉς ]
+		// tips... R[obN̒玩g⑼̃^C}[Ă\܂
+		//===================================================================================
+		bool cancel(const Handle handle);
+
+		//===================================================================================
+		// S^C}[̉
+		//===================================================================================
+		void clear();
+
+		//===================================================================================
+		// K莞Ԍo߂^C}[̃R[obNĂяoAbvf[g( t[ĂяoOK )
+		// arg1... t[Ԃ̌oߎ( bw )
+		// tips... R[obN̈ɂ arg1 ̂܂ܓn܂
+		//===================================================================================
+		void update(const float delta_time);
+
+		//===================================================================================
+		// Lȃnh ( ĂȂ )
+		//===================================================================================
+		inline bool isActive(const Handle handle) const noexcept {
+			const uint32_t index = handle & INDEX_MASK;
+			return INVALID_HANDLE != handle && index < nodes_.size() && nodes_[index].generation_ == (handle >> INDEX_BITS);
+		}
+
+		//===================================================================================
+		// ̃R[obNĂяo܂ł̎c莞 ( b )
+		// tips... ς݂̃nh 0 Ԃ܂
+		//===================================================================================
+		float getRemainTime(const Handle handle) const noexcept;
+
+		//===================================================================================
+		// o^̃^C}[
+		//===================================================================================
+		inline uint32_t getSize() const noexcept { return size_; }
+
+		//===================================================================================
+		// w萔̃^C}[o^ł悤̈m
+		//===================================================================================
+		void reserve(const uint32_t num);
+
+		//===================================================================================
+		// p̃^C}[zC[
+		// tips... gameMain ȂǂŖt[ GetCentral().update( delta_time ) ĂяoĂ
+		//===================================================================================
+		static TimerWheel& GetCentral() {
+			static TimerWheel wheel;
+			return wheel;
+		}
+
+	private:
+		static constexpr uint32_t INDEX_BITS = 20;
+		static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+		static constexpr uint32_t GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+
+		// 1 i 256 Xbg ~ 4 i ( 2^32 tick ܂ŁA͍ŏiőҋ@ )
+		static constexpr uint32_t SLOT_BITS = 8;
+		static constexpr uint32_t SLOT_NUM = 1u << SLOT_BITS;
+		static constexpr uint32_t SLOT_MASK = SLOT_NUM - 1;
+		static constexpr uint32_t LEVEL_NUM = 4;
+		static constexpr uint32_t NIL = 0xffffffff;
+
+		// Node::list_ ̓l ( ȊO̓Xbgԍ )
+		static constexpr uint32_t LIST_FREE = LEVEL_NUM * SLOT_NUM;	// gp
+		static constexpr uint32_t LIST_FIRE = LIST_FREE + 1;		// Ăяo҂
+		static constexpr uint32_t LIST_BEHIND = LIST_FREE + 2;		// x̂ߎ update ̍ŏɌĂяo
+
+		// ŎQƂ݂̂ ( R[obN functions_ ɕ )
+		struct Node {
+			uint64_t deadline_;		// ɌĂяo ( tick )
+			uint64_t interval_;		// K莞 ( tick )
+			uint32_t prev_;
+			uint32_t next_;
+			uint32_t list_;
+			uint32_t generation_;
+		};
+
+		Handle registFunction(std::function<void(const float)> func, const float regulation_time, const bool is_callback_start);
+		void link(const uint32_t index, uint64_t expire);
+		void unlink(const uint32_t index);
+		void release(const uint32_t index);
+		void cascade(const uint32_t level);
+		void fireSlot(const uint32_t slot);
+		void fire(const Handle handle);
+		bool findOccupied(const uint32_t first, const uint32_t last, uint32_t& out) const noexcept;
+
+		std::vector<Node> nodes_;
+		std::vector<std::function<void(const float)>> functions_;
+		std::vector<uint32_t> fire_;
+		std::vector<uint32_t> behind_;
+		uint32_t heads_[LEVEL_NUM * SLOT_NUM];
+		uint64_t occupied_[SLOT_NUM / 64];	// ŉi̋łȂXbg
+		uint32_t free_ = NIL;
+		uint32_t size_ = 0;
+		uint64_t now_ = 0;
+		uint64_t target_ = 0;
+		double remain_ = 0;
+		double resolution_;
+		float delta_time_ = 0;
+	};
+
+}
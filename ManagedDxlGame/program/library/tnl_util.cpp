@@ -353,148 +353,6 @@ namespace tnl {
 		return buf;
 	}
 
-	//----------------------------------------------------------------------------------------------
-	int SpaceBit32(int n) {
-		n = (n | (n << 8)) & 0x00ff00ff;
-		n = (n | (n << 4)) & 0x0f0f0f0f;
-		n = (n | (n << 2)) & 0x33333333;
-		return (n | (n << 1)) & 0x55555555;
-	}
-
-	//----------------------------------------------------------------------------------------------
-	int CountBit8(const uint8_t v) {
-		uint8_t count = (v & 0x55) + ((v >> 1) & 0x55);
-		count = (count & 0x33) + ((count >> 2) & 0x33);
-		return (count & 0x0f) + ((count >> 4) & 0x0f);
-	}
-
-	//----------------------------------------------------------------------------------------------
-	int CountBit16(const uint16_t v) {
-		uint16_t count = (v & 0x5555) + ((v >> 1) & 0x5555);
-		count = (count & 0x3333) + ((count >> 2) & 0x3333);
-		count = (count & 0x0f0f) + ((count >> 4) & 0x0f0f);
-		return (count & 0x00ff) + ((count >> 8) & 0x00ff);
-	}
-
-	//----------------------------------------------------------------------------------------------
-	int CountBit32(const uint32_t v) {
-		uint32_t count = (v & 0x55555555) + ((v >> 1) & 0x55555555);
-		count = (count & 0x33333333) + ((count >> 2) & 0x33333333);
-		count = (count & 0x0f0f0f0f) + ((count >> 4) & 0x0f0f0f0f);
-		count = (count & 0x00ff00ff) + ((count >> 8) & 0x00ff00ff);
-		return (count & 0x0000ffff) + ((count >> 16) & 0x0000ffff);
-	}
-
-	//----------------------------------------------------------------------------------------------
-	int CountBit64(const uint64_t v) {
-		uint64_t count = (v & 0x5555555555555555) + ((v >> 1) & 0x5555555555555555);
-		count = (count & 0x3333333333333333) + ((count >> 2) & 0x3333333333333333);
-		count = (count & 0x0f0f0f0f0f0f0f0f) + ((count >> 4) & 0x0f0f0f0f0f0f0f0f);
-		count = (count & 0x00ff00ff00ff00ff) + ((count >> 8) & 0x00ff00ff00ff00ff);
-		count = (count & 0x0000ffff0000ffff) + ((count >> 16) & 0x0000ffff0000ffff);
-		return (int)((count & 0x00000000ffffffff) + ((count >> 32) & 0x00000000ffffffff));
-	}
-
-	//----------------------------------------------------------------------------------------------
-	bool MostBit8(const uint8_t value, int& out) {
-		if (value == 0) return false;
-		uint8_t v = value;
-		v |= (v >> 1);
-		v |= (v >> 2);
-		v |= (v >> 4);
-		out = CountBit8(v) - 1;
-		return true;
-	}
-
-	//----------------------------------------------------------------------------------------------
-	bool MostBit16(const uint16_t value, int& out) {
-		if (value == 0) return false;
-		uint16_t v = value;
-		v |= (v >> 1);
-		v |= (v >> 2);
-		v |= (v >> 4);
-		v |= (v >> 8);
-		out = CountBit16(v) - 1;
-		return true;
-	}
-
-	//----------------------------------------------------------------------------------------------
-	bool MostBit32(const uint32_t value, int& out) {
-		if (value == 0) return false;
-		uint32_t v = value;
-		v |= (v >> 1);
-		v |= (v >> 2);
-		v |= (v >> 4);
-		v |= (v >> 8);
-		v |= (v >> 16);
-		out = CountBit32(v) - 1;
-		return true;
-	}
-
-	//----------------------------------------------------------------------------------------------
-	bool MostBit64(const uint64_t value, int& out) {
-		if (value == 0) return false;
-		uint64_t v = value;
-		v |= (v >> 1);
-		v |= (v >> 2);
-		v |= (v >> 4);
-		v |= (v >> 8);
-		v |= (v >> 16);
-		v |= (v >> 32);
-		out = CountBit64(v) - 1;
-		return true;
-	}
-
-	//----------------------------------------------------------------------------------------------
-	bool LeastBit8(const uint8_t value, int& out) {
-		if (value == 0) return false;
-		uint8_t v = value;
-		v |= (v << 1);
-		v |= (v << 2);
-		v |= (v << 4);
-		out = 8 - CountBit8(v);
-		return true;
-	}
-
-	//----------------------------------------------------------------------------------------------
-	bool LeastBit16(const uint16_t value, int& out) {
-		if (value == 0) return false;
-		uint16_t v = value;
-		v |= (v << 1);
-		v |= (v << 2);
-		v |= (v << 4);
-		v |= (v << 8);
-		out = 16 - CountBit16(v);
-		return true;
-	}
-
-	//----------------------------------------------------------------------------------------------
-	bool LeastBit32(const uint32_t value, int& out) {
-		if (value == 0) return false;
-		uint32_t v = value;
-		v |= (v << 1);
-		v |= (v << 2);
-		v |= (v << 4);
-		v |= (v << 8);
-		v |= (v << 16);
-		out = 32 - CountBit32(v);
-		return true;
-	}
-
-	//----------------------------------------------------------------------------------------------
-	bool LeastBit64(const uint64_t value, int& out) {
-		if (value == 0) return false;
-		uint64_t v = value;
-		v |= (v << 1);
-		v |= (v << 2);
-		v |= (v << 4);
-		v |= (v << 8);
-		v |= (v << 16);
-		v |= (v << 32);
-		out = 64 - CountBit64(v);
-		return true;
-	}
-
 
 }
 
@@ -6,6 +6,7 @@
 #include <string>
 #include <memory>
 #include <tuple>
+#include <bit>
 #include "tnl_using.h"
 
 namespace tnl{
@@ -168,32 +169,63 @@ namespace tnl{
 
 	//----------------------------------------------------------------------------------------------
 	// PrbgÂԊuJ
-	int SpaceBit32(int n);
+	constexpr int SpaceBit32(int n) {
+		uint32_t v = static_cast<uint32_t>(n);
+		v = (v | (v << 8)) & 0x00ff00ff;
+		v = (v | (v << 4)) & 0x0f0f0f0f;
+		v = (v | (v << 2)) & 0x33333333;
+		return static_cast<int>((v | (v << 1)) & 0x55555555);
+	}
 
 	//----------------------------------------------------------------------------------------------
 	// LȃrbgJEg
-	int CountBit8(const uint8_t v);
-	int CountBit16(const uint16_t v);
-	int CountBit32(const uint32_t v);
-	int CountBit64(const uint64_t v);
+	// tips... std::popcount gp̂ CPU  popcnt ߂g܂
+	constexpr int CountBit8(const uint8_t v) { return std::popcount(v); }
+	constexpr int CountBit16(const uint16_t v) { return std::popcount(v); }
+	constexpr int CountBit32(const uint32_t v) { return std::popcount(v); }
+	constexpr int CountBit64(const uint64_t v) { return std::popcount(v); }
 
 	//----------------------------------------------------------------------------------------------
 	// őLrbgiMSBFMost Significant Bitj
 	// SẴrbg 0 Ȃ false A
 	// ) value  0xFF Ȃ out ɂ value  Bit-1  uint8_t Ȃ 7
-	bool MostBit8(const uint8_t value, int& out);
-	bool MostBit16(const uint16_t value, int& out);
-	bool MostBit32(const uint32_t value, int& out);
-	bool MostBit64(const uint64_t value, int& out);
+	constexpr bool MostBit8(const uint8_t value, int& out) { if (value == 0) return false; out = std::bit_width(value) - 1; return true; }
+	constexpr bool MostBit16(const uint16_t value, int& out) { if (value == 0) return false; out = std::bit_width(value) - 1; return true; }
+	constexpr bool MostBit32(const uint32_t value, int& out) { if (value == 0) return false; out = std::bit_width(value) - 1; return true; }
+	constexpr bool MostBit64(const uint64_t value, int& out) { if (value == 0) return false; out = std::bit_width(value) - 1; return true; }
 
 	//----------------------------------------------------------------------------------------------
 	// ŏLrbgiLSBFLeast Significant Bitj
 	// SẴrbg 0 Ȃ false A
 	// ) value  0x01 Ȃ out ɂ 0 
-	bool LeastBit8(const uint8_t value, int& out);
-	bool LeastBit16(const uint16_t value, int& out);
-	bool LeastBit32(const uint32_t value, int& out);
-	bool LeastBit64(const uint64_t value, int& out);
+	constexpr bool LeastBit8(const uint8_t value, int& out) { if (value == 0) return false; out = std::countr_zero(value); return true; }
+	constexpr bool LeastBit16(const uint16_t value, int& out) { if (value == 0) return false; out = std::countr_zero(value); return true; }
+	constexpr bool LeastBit32(const uint32_t value, int& out) { if (value == 0) return false; out = std::countr_zero(value); return true; }
+	constexpr bool LeastBit64(const uint64_t value, int& out) { if (value == 0) return false; out = std::countr_zero(value); return true; }
+
+	//----------------------------------------------------------------------------------------------
+	// 64 bit l̗Lȃrbgԍʂ珇ɗ񋓂
+	// tips... gp
+	//         for (int n : tnl::BitRange64(mask)) { ... }
+	//         Lȃrbg̐[vA0 ̃rbg͓ǂݔ΂܂
+	class BitRange64 final {
+	public:
+		class iterator final {
+		public:
+			constexpr explicit iterator(const uint64_t bits) noexcept : bits_(bits) {}
+			constexpr int operator*() const noexcept { return std::countr_zero(bits_); }
+			constexpr iterator& operator++() noexcept { bits_ &= bits_ - 1; return *this; }
+			constexpr bool operator!=(const iterator& other) const noexcept { return bits_ != other.bits_; }
+		private:
+			uint64_t bits_;
+		};
+		constexpr explicit BitRange64(const uint64_t bits) noexcept : bits_(bits) {}
+		constexpr iterator begin() const noexcept { return iterator(bits_); }
+		constexpr iterator end() const noexcept { return iterator(0); }
+		constexpr int size() const noexcept { return std::popcount(bits_); }
+	private:
+		uint64_t bits_;
+	};
 
 }
 
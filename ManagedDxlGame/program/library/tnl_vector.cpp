@@ -2,11 +2,10 @@
 #include "tnl_vector.h"
 #include "tnl_quaternion.h"
 #include "tnl_matrix.h"
+#include "tnl_rng.h"
 
 namespace tnl {
 
-	using namespace DirectX;
-
 	const Vector3 Vector3::forward	= { 0,  0,  1 };
 	const Vector3 Vector3::back		= { 0,  0, -1 };
 	const Vector3 Vector3::left		= {-1,  0,  0 };
@@ -32,36 +31,92 @@ namespace tnl {
 
 	//-----------------------------------------------------------------------------------------------------
 	Vector3 Vector3::TransformCoord(const Vector3& v, const Quaternion& q) noexcept {
-		XMVECTOR xv = XMVector3Rotate( XMLoadFloat3(&v), XMLoadFloat4(&q));
-		XMFLOAT3 f3;
-		XMStoreFloat3(&f3, xv); 
-		return static_cast<Vector3>(f3);
+		return Vector3(simd::Rotate3(simd::Load3(v), simd::Load4(q)));
 	}
 	//-----------------------------------------------------------------------------------------------------
 	Vector3 Vector3::InverseTransformCoord(const Vector3& v, const Quaternion& q) noexcept {
-		XMVECTOR xv = XMVector3InverseRotate(XMLoadFloat3(&v), XMLoadFloat4(&q));
-		XMFLOAT3 f3;
-		XMStoreFloat3(&f3, xv);
-		return static_cast<Vector3>(f3);
+		return Vector3(simd::InverseRotate3(simd::Load3(v), simd::Load4(q)));
 	}
 
 	//-----------------------------------------------------------------------------------------------------
 	Vector3 Vector3::TransformCoord(const Vector3& v, const tnl::Matrix& m) noexcept {
-		XMFLOAT3 f3;
-		DirectX::XMStoreFloat3(&f3, DirectX::XMVector3TransformCoord(DirectX::XMLoadFloat3(&v), DirectX::XMLoadFloat4x4(&m)));
-		return static_cast<Vector3>(f3);
+		const simd::vec4 p = simd::Load3(v);
+		simd::vec4 r = simd::MulAdd(simd::SplatZ(p), simd::Load4(m.m[2]), simd::Load4(m.m[3]));
+		r = simd::MulAdd(simd::SplatY(p), simd::Load4(m.m[1]), r);
+		r = simd::MulAdd(simd::SplatX(p), simd::Load4(m.m[0]), r);
+		return Vector3(simd::Div(r, simd::SplatW(r)));
+	}
+
+	//-----------------------------------------------------------------------------------------------------
+	void Vector3::TransformCoord(
+		const float* in_x, const float* in_y, const float* in_z,
+		float* out_x, float* out_y, float* out_z,
+		const uint32_t num, const tnl::Matrix& m) noexcept {
+
+		uint32_t i = 0;
+
+#if defined(TNL_SIMD_AVX2)
+		// s̊evf 8 [֓WJĂ x, y, z e 8 vf܂Ƃ߂ĕϊ
+		__m256 m11 = _mm256_set1_ps(m._11), m12 = _mm256_set1_ps(m._12), m13 = _mm256_set1_ps(m._13), m14 = _mm256_set1_ps(m._14);
+		__m256 m21 = _mm256_set1_ps(m._21), m22 = _mm256_set1_ps(m._22), m23 = _mm256_set1_ps(m._23), m24 = _mm256_set1_ps(m._24);
+		__m256 m31 = _mm256_set1_ps(m._31), m32 = _mm256_set1_ps(m._32), m33 = _mm256_set1_ps(m._33), m34 = _mm256_set1_ps(m._34);
+		__m256 m41 = _mm256_set1_ps(m._41), m42 = _mm256_set1_ps(m._42), m43 = _mm256_set1_ps(m._43), m44 = _mm256_set1_ps(m._44);
+	#if defined(TNL_SIMD_FMA)
+		#define TNL_MADD8(a, b, c) _mm256_fmadd_ps(a, b, c)
+	#else
+		#define TNL_MADD8(a, b, c) _mm256_add_ps(_mm256_mul_ps(a, b), c)
+	#endif
+		for (; i + 8 <= num; i += 8) {
+			__m256 x = _mm256_loadu_ps(in_x + i);
+			__m256 y = _mm256_loadu_ps(in_y + i);
+			__m256 z = _mm256_loadu_ps(in_z + i);
+			__m256 rx = TNL_MADD8(x, m11, TNL_MADD8(y, m21, TNL_MADD8(z, m31, m41)));
+			__m256 ry = TNL_MADD8(x, m12, TNL_MADD8(y, m22, TNL_MADD8(z, m32, m42)));
+			__m256 rz = TNL_MADD8(x, m13, TNL_MADD8(y, m23, TNL_MADD8(z, m33, m43)));
+			__m256 rw = TNL_MADD8(x, m14, TNL_MADD8(y, m24, TNL_MADD8(z, m34, m44)));
+			_mm256_storeu_ps(out_x + i, _mm256_div_ps(rx, rw));
+			_mm256_storeu_ps(out_y + i, _mm256_div_ps(ry, rw));
+			_mm256_storeu_ps(out_z + i, _mm256_div_ps(rz, rw));
+		}
+		#undef TNL_MADD8
+#endif
+
+#if !defined(TNL_SIMD_SCALAR)
+		// 4 vf ( AVX2 ł͒[ )
+		simd::vec4 v11 = simd::Splat(m._11), v12 = simd::Splat(m._12), v13 = simd::Splat(m._13), v14 = simd::Splat(m._14);
+		simd::vec4 v21 = simd::Splat(m._21), v22 = simd::Splat(m._22), v23 = simd::Splat(m._23), v24 = simd::Splat(m._24);
+		simd::vec4 v31 = simd::Splat(m._31), v32 = simd::Splat(m._32), v33 = simd::Splat(m._33), v34 = simd::Splat(m._34);
+		simd::vec4 v41 = simd::Splat(m._41), v42 = simd::Splat(m._42), v43 = simd::Splat(m._43), v44 = simd::Splat(m._44);
+		for (; i + 4 <= num; i += 4) {
+			simd::vec4 x = simd::Load4(in_x + i);
+			simd::vec4 y = simd::Load4(in_y + i);
+			simd::vec4 z = simd::Load4(in_z + i);
+			simd::vec4 rx = simd::MulAdd(x, v11, simd::MulAdd(y, v21, simd::MulAdd(z, v31, v41)));
+			simd::vec4 ry = simd::MulAdd(x, v12, simd::MulAdd(y, v22, simd::MulAdd(z, v32, v42)));
+			simd::vec4 rz = simd::MulAdd(x, v13, simd::MulAdd(y, v23, simd::MulAdd(z, v33, v43)));
+			simd::vec4 rw = simd::MulAdd(x, v14, simd::MulAdd(y, v24, simd::MulAdd(z, v34, v44)));
+			simd::Store4(out_x + i, simd::Div(rx, rw));
+			simd::Store4(out_y + i, simd::Div(ry, rw));
+			simd::Store4(out_z + i, simd::Div(rz, rw));
+		}
+#endif
+
+		// [ ( XJ[ł͑Svf )
+		for (; i < num; ++i) {
+			float x = in_x[i], y = in_y[i], z = in_z[i];
+			float rw = x * m._14 + y * m._24 + z * m._34 + m._44;
+			out_x[i] = (x * m._11 + y * m._21 + z * m._31 + m._41) / rw;
+			out_y[i] = (x * m._12 + y * m._22 + z * m._32 + m._42) / rw;
+			out_z[i] = (x * m._13 + y * m._23 + z * m._33 + m._43) / rw;
+		}
 	}
 
 	//-----------------------------------------------------------------------------------------------------
 	Vector3 Vector3::Transform(const tnl::Vector3& v, const tnl::Matrix& m) noexcept {
-		XMFLOAT3 f3;
-		DirectX::XMStoreFloat3(&f3, DirectX::XMVector3Transform(DirectX::XMLoadFloat3(&v), DirectX::XMLoadFloat4x4(&m)));
-		return static_cast<Vector3>(f3);
+		return Vector3(simd::TransformRow(simd::Load3Point(v), simd::LoadMatrix(m)));
 	}
 	Vector3 Vector3::TransformNormal(const tnl::Vector3& v, const tnl::Matrix& m) noexcept {
-		XMFLOAT3 f3;
-		DirectX::XMStoreFloat3(&f3, DirectX::XMVector3TransformNormal(DirectX::XMLoadFloat3(&v), DirectX::XMLoadFloat4x4(&m)));
-		return static_cast<Vector3>(f3);
+		return Vector3(simd::TransformRow(simd::Load3(v), simd::LoadMatrix(m)));
 	}
 
 
@@ -134,6 +189,19 @@ namespace tnl {
 		return v;
 	}
 
+	void Vector3::Random(
+		Vector3* out, const uint32_t num,
+		const float min_x, const float max_x,
+		const float min_y, const float max_y,
+		const float min_z, const float max_z) noexcept {
+		tnl::Rng& rng = tnl::Rng::Thread();
+		for (uint32_t i = 0; i < num; ++i) {
+			out[i].x = rng.range(min_x, max_x);
+			out[i].y = rng.range(min_y, max_y);
+			out[i].z = rng.range(min_z, max_z);
+		}
+	}
+
 
 }
 
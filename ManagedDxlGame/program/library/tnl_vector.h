@@ -1,19 +1,20 @@
 #pragma once
-#include <DirectXMath.h>
 #include <string>
+#include <type_traits>
 #include "tnl_util.h"
+#include "tnl_simd.h"
 
 namespace tnl {
 	class Matrix;
 	class Quaternion;
 
-	class Vector3 final : public DirectX::XMFLOAT3 {
+	class Vector3 final : public Float3 {
 	public :	
-		Vector3() noexcept :DirectX::XMFLOAT3(0, 0, 0) {}
-		Vector3(const float xx, const float yy, const float zz) noexcept : DirectX::XMFLOAT3(xx, yy, zz) {}
-		explicit Vector3(const float xyz) noexcept : DirectX::XMFLOAT3(xyz, xyz, xyz) {}
-		explicit Vector3(DirectX::XMVECTOR& v) noexcept { DirectX::XMStoreFloat3(this, v); }
-		explicit Vector3(DirectX::XMFLOAT3& v) noexcept : DirectX::XMFLOAT3(v.x, v.y, v.z) {}
+		constexpr Vector3() noexcept : Float3(0, 0, 0) {}
+		constexpr Vector3(const float xx, const float yy, const float zz) noexcept : Float3(xx, yy, zz) {}
+		constexpr explicit Vector3(const float xyz) noexcept : Float3(xyz, xyz, xyz) {}
+		explicit Vector3(const simd::vec4& v) noexcept { simd::Store3(*this, v); }
+		constexpr explicit Vector3(const Float3& v) noexcept : Float3(v.x, v.y, v.z) {}
 
 		static const Vector3 forward;
 		static const Vector3 back;
@@ -45,39 +46,42 @@ namespace tnl {
 		//
 		// operator
 		//
+		// tips... lZ͐ constexpr CC֐ł
+		//         ͈ꎞIuWFNgoRg𒼐ڍXV܂
+		//
 
-		Vector3& operator = (DirectX::XMVECTOR& other) noexcept;
-		Vector3& operator = (const float other) noexcept;
+		Vector3& operator = (const simd::vec4& other) noexcept;
+		constexpr Vector3& operator = (const float other) noexcept;
 
-		Vector3 operator * (const float other) const noexcept;
-		Vector3 operator * (const Vector3& other) const noexcept;
-		Vector3& operator *= (const float other) noexcept;
-		Vector3& operator *= (const Vector3& other) noexcept;
+		constexpr Vector3 operator * (const float other) const noexcept;
+		constexpr Vector3 operator * (const Vector3& other) const noexcept;
+		constexpr Vector3& operator *= (const float other) noexcept;
+		constexpr Vector3& operator *= (const Vector3& other) noexcept;
 
-		Vector3 operator / (const float other) const noexcept;
-		Vector3 operator / (const Vector3& other) const noexcept;
-		Vector3& operator /= (const float other) noexcept;
-		Vector3& operator /= (const Vector3& other) noexcept;
+		constexpr Vector3 operator / (const float other) const noexcept;
+		constexpr Vector3 operator / (const Vector3& other) const noexcept;
+		constexpr Vector3& operator /= (const float other) noexcept;
+		constexpr Vector3& operator /= (const Vector3& other) noexcept;
 
-		Vector3 operator + (const Vector3& other) const noexcept;
-		Vector3& operator += (const Vector3& other) noexcept;
-		Vector3 operator - (const Vector3& other) const noexcept;
-		Vector3& operator -= (const Vector3& other) noexcept;
-		Vector3 operator - () const noexcept;
+		constexpr Vector3 operator + (const Vector3& other) const noexcept;
+		constexpr Vector3& operator += (const Vector3& other) noexcept;
+		constexpr Vector3 operator - (const Vector3& other) const noexcept;
+		constexpr Vector3& operator -= (const Vector3& other) noexcept;
+		constexpr Vector3 operator - () const noexcept;
 
 		//-----------------------------------------------------------------------------------------------------
 		//
 		// inline function
 		//
-		float	dot(const Vector3& v)	noexcept;
+		constexpr float	dot(const Vector3& v)	const noexcept;
 		float	angle(const Vector3& v) const noexcept;
 		void	normalize()				noexcept;
-		Vector3	cross(const Vector3& v) const noexcept;
+		constexpr Vector3	cross(const Vector3& v) const noexcept;
 		float	length()				const noexcept;
-		Vector3	xy()					const noexcept;
-		Vector3	xz()					const noexcept;
-		Vector3	yz()					const noexcept;
-		DirectX::XMFLOAT4 float4()		const noexcept;
+		constexpr Vector3	xy()		const noexcept;
+		constexpr Vector3	xz()		const noexcept;
+		constexpr Vector3	yz()		const noexcept;
+		constexpr Float4	float4()	const noexcept;
 		std::string toString(const std::string& format = "%f")	const noexcept;
 
 		//-----------------------------------------------------------------------------------------------------
@@ -85,10 +89,10 @@ namespace tnl {
 		// static inline function
 		//
 		static Vector3	Normalize(const Vector3& v) noexcept;
-		static Vector3	Lerp(const tnl::Vector3& s, const tnl::Vector3& e, float _stage_id) noexcept;
-		static float	Dot(const tnl::Vector3& v1, const tnl::Vector3& v2) noexcept;
-		static Vector3	Cross(const tnl::Vector3& v1, const tnl::Vector3& v2) noexcept;
-		static Vector3	Rot2D(const tnl::Vector3 v, float sin, float cos) noexcept;
+		static constexpr Vector3	Lerp(const tnl::Vector3& s, const tnl::Vector3& e, float _stage_id) noexcept;
+		static constexpr float		Dot(const tnl::Vector3& v1, const tnl::Vector3& v2) noexcept;
+		static constexpr Vector3	Cross(const tnl::Vector3& v1, const tnl::Vector3& v2) noexcept;
+		static constexpr Vector3	Rot2D(const tnl::Vector3 v, float sin, float cos) noexcept;
 		static Vector3	Transform(const tnl::Vector3& v, const tnl::Matrix& m) noexcept;
 		static Vector3	TransformNormal(const tnl::Vector3& v, const tnl::Matrix& m) noexcept;
 		static Vector3	Reflection(const tnl::Vector3& in, const tnl::Vector3& normal) noexcept;
@@ -101,10 +105,37 @@ namespace tnl {
 		static Vector3 TransformCoord(const Vector3& v, const tnl::Matrix& m) noexcept;
 		static Vector3 TransformCoord(const Vector3 &v, const Quaternion &q) noexcept ;
 		static Vector3 InverseTransformCoord(const Vector3& v, const Quaternion& q) noexcept;
+
+		//-----------------------------------------------------------------------------------------------------
+		// Wz̈ꊇϊ ( SoA ` )
+		// arg1...  x Wz
+		// arg2...  y Wz
+		// arg3...  z Wz
+		// arg4... o x Wz
+		// arg5... o y Wz
+		// arg6... o z Wz
+		// arg7... vf
+		// arg8... ϊs
+		// tips... ʂ͗vf TransformCoord Ɠł
+		//         ͂Əo͂ɓzw肵Ă\܂
+		//         AVX2 ł 8 vf, SSE / NEON ł 4 vf܂Ƃ߂ď܂
+		static void TransformCoord(
+			const float* in_x, const float* in_y, const float* in_z,
+			float* out_x, float* out_y, float* out_z,
+			const uint32_t num, const tnl::Matrix& m) noexcept;
+
 		static Vector3 CreateScreenRay(const int screen_x, const int screen_y, const int screen_w, const int screen_h, const tnl::Matrix& view, const tnl::Matrix& proj) noexcept ;
 		static Vector3 ConvertToScreen(const Vector3& v, const float screen_w, const float screen_h, const Matrix& view, const Matrix& proj) noexcept;
 		static Vector3 Random( const float min_x, const float max_x, const float min_y, const float max_y, const float min_z, const float max_z ) noexcept;
 
+		//-----------------------------------------------------------------------------------------------------
+		// _ȍẄꊇ擾
+		// arg1... 󂯎pz
+		// arg2... vf
+		// arg3-8. e ŏl, ől
+		// tips... tnl::Rng::Thread() gp܂
+		static void Random( Vector3* out, const uint32_t num, const float min_x, const float max_x, const float min_y, const float max_y, const float min_z, const float max_z ) noexcept;
+
 	private:
 		static const Vector3 axis[static_cast<uint32_t>(eAxis::MAX)];
 	};
@@ -117,12 +148,12 @@ namespace tnl {
 	}
 
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3& Vector3::operator = (DirectX::XMVECTOR& other) noexcept {
-		DirectX::XMStoreFloat3(this, other);
+	inline Vector3& Vector3::operator = (const simd::vec4& other) noexcept {
+		simd::Store3(*this, other);
 		return *this;
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3& Vector3::operator = (const float other) noexcept {
+	constexpr Vector3& Vector3::operator = (const float other) noexcept {
 		this->x = other;
 		this->y = other;
 		this->z = other;
@@ -137,7 +168,7 @@ namespace tnl {
 	//	DirectX::XMStoreFloat3(&f3, v);
 	//	return static_cast<Vector3>(f3);
 	//}
-	inline Vector3 Vector3::operator * (const Vector3& other) const noexcept {
+	constexpr Vector3 Vector3::operator * (const Vector3& other) const noexcept {
 		return { x * other.x, y * other.y, z * other.z };
 	}
 	//-----------------------------------------------------------------------------------------------------
@@ -150,18 +181,17 @@ namespace tnl {
 	//	DirectX::XMStoreFloat3(&f3, v);
 	//	return static_cast<Vector3>(f3);
 	//}
-	inline Vector3 Vector3::operator * (const float other) const noexcept {
+	constexpr Vector3 Vector3::operator * (const float other) const noexcept {
 		return { x * other, y * other, z * other };
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3& Vector3::operator *= (const float other) noexcept {
-		*this = *this * other;
+	constexpr Vector3& Vector3::operator *= (const float other) noexcept {
+		x *= other; y *= other; z *= other;
 		return *this;
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3& Vector3::operator *= (const Vector3& other) noexcept {
-		Vector3 v = other;
-		*this = *this * v;
+	constexpr Vector3& Vector3::operator *= (const Vector3& other) noexcept {
+		x *= other.x; y *= other.y; z *= other.z;
 		return *this;
 	}
 	//-----------------------------------------------------------------------------------------------------
@@ -174,7 +204,7 @@ namespace tnl {
 	//	DirectX::XMStoreFloat3(&f3, v);
 	//	return static_cast<Vector3>(f3);
 	//}
-	inline Vector3 Vector3::operator / (const float other) const noexcept {
+	constexpr Vector3 Vector3::operator / (const float other) const noexcept {
 		return { x / other, y / other, z / other };
 	}
 	//-----------------------------------------------------------------------------------------------------
@@ -186,49 +216,47 @@ namespace tnl {
 	//	DirectX::XMStoreFloat3(&f3, v);
 	//	return static_cast<Vector3>(f3);
 	//}
-	inline Vector3 Vector3::operator / (const Vector3& other) const noexcept {
+	constexpr Vector3 Vector3::operator / (const Vector3& other) const noexcept {
 		return { x / other.x, y / other.y, z / other.z };
 	}
 
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3& Vector3::operator /= (const float other) noexcept {
-		*this = *this / other;
+	constexpr Vector3& Vector3::operator /= (const float other) noexcept {
+		x /= other; y /= other; z /= other;
 		return *this;
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3& Vector3::operator /= (const Vector3& other) noexcept {
-		*this = *this / other;
+	constexpr Vector3& Vector3::operator /= (const Vector3& other) noexcept {
+		x /= other.x; y /= other.y; z /= other.z;
 		return *this;
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3 Vector3::operator + (const Vector3& other) const noexcept {
-		DirectX::XMFLOAT3 f3(this->x + other.x, this->y + other.y, this->z + other.z);
-		return static_cast<Vector3>(f3);
+	constexpr Vector3 Vector3::operator + (const Vector3& other) const noexcept {
+		return { x + other.x, y + other.y, z + other.z };
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3& Vector3::operator += (const Vector3& other) noexcept {
-		*this = *this + other;
+	constexpr Vector3& Vector3::operator += (const Vector3& other) noexcept {
+		x += other.x; y += other.y; z += other.z;
 		return *this;
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3 Vector3::operator - (const Vector3& other) const noexcept {
-		DirectX::XMFLOAT3 f3(this->x - other.x, this->y - other.y, this->z - other.z);
-		return static_cast<Vector3>(f3);
+	constexpr Vector3 Vector3::operator - (const Vector3& other) const noexcept {
+		return { x - other.x, y - other.y, z - other.z };
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3& Vector3::operator -= (const Vector3& other) noexcept {
-		*this = *this - other;
+	constexpr Vector3& Vector3::operator -= (const Vector3& other) noexcept {
+		x -= other.x; y -= other.y; z -= other.z;
 		return *this;
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3 Vector3::operator-() const noexcept {
-		Vector3 v = {-x, -y, -z};
-		return v;
+	constexpr Vector3 Vector3::operator-() const noexcept {
+		return { -x, -y, -z };
 	}
 
 	//-----------------------------------------------------------------------------------------------------
-	inline float Vector3::dot(const Vector3& v) noexcept {
-		return DirectX::XMVector3Dot(DirectX::XMLoadFloat3(this), DirectX::XMLoadFloat3(&v) ).m128_f32[0];
+	// tips... 萔̕]̓XJ[vZ, s SIMD ŌvZ܂
+	constexpr float Vector3::dot(const Vector3& v) const noexcept {
+		return Dot(*this, v);
 	}
 	//-----------------------------------------------------------------------------------------------------
 	inline float Vector3::angle(const Vector3& v) const noexcept {
@@ -240,25 +268,23 @@ namespace tnl {
 	}
 	//-----------------------------------------------------------------------------------------------------
 	inline void Vector3::normalize() noexcept {
-		DirectX::XMStoreFloat3(this, DirectX::XMVector3Normalize(DirectX::XMLoadFloat3(this)));
+		simd::Store3(*this, simd::Normalize3(simd::Load3(*this)));
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3 Vector3::cross(const Vector3& v) const noexcept {
-		XMFLOAT3 f3;
-		DirectX::XMStoreFloat3(&f3, DirectX::XMVector3Cross(DirectX::XMLoadFloat3(this), DirectX::XMLoadFloat3(&v)));
-		return static_cast<Vector3>(f3);
+	constexpr Vector3 Vector3::cross(const Vector3& v) const noexcept {
+		return Cross(*this, v);
 	}
 	//-----------------------------------------------------------------------------------------------------
 	inline float Vector3::length() const noexcept {
-		return DirectX::XMVector3Length(DirectX::XMLoadFloat3(this)).m128_f32[0];
+		return simd::Length3(simd::Load3(*this));
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3 Vector3::xz() const noexcept { return { x, 0, z }; }
-	inline Vector3 Vector3::xy() const noexcept { return { x, y, 0 }; }
-	inline Vector3 Vector3::yz() const noexcept { return { 0, y, z }; }
+	constexpr Vector3 Vector3::xz() const noexcept { return { x, 0, z }; }
+	constexpr Vector3 Vector3::xy() const noexcept { return { x, y, 0 }; }
+	constexpr Vector3 Vector3::yz() const noexcept { return { 0, y, z }; }
 
 	//-----------------------------------------------------------------------------------------------------
-	inline DirectX::XMFLOAT4 Vector3::float4() const noexcept { return { x, y, z, 1.0f }; }
+	constexpr Float4 Vector3::float4() const noexcept { return { x, y, z, 1.0f }; }
 
 	//-----------------------------------------------------------------------------------------------------
 	inline std::string Vector3::toString(const std::string& format) const noexcept {
@@ -274,26 +300,32 @@ namespace tnl {
 
 	//-----------------------------------------------------------------------------------------------------
 	inline Vector3 Vector3::Normalize(const Vector3& v) noexcept {
-		XMFLOAT3 f3;
-		DirectX::XMStoreFloat3(&f3, DirectX::XMVector3Normalize(DirectX::XMLoadFloat3(&v)));
-		return static_cast<Vector3>(f3);
+		return Vector3(simd::Normalize3(simd::Load3(v)));
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3 Vector3::Lerp(const tnl::Vector3& s, const tnl::Vector3& e, float _stage_id) noexcept {
-		return s + (e - s) * _stage_id;
+	// tips... s + (e - s) * t 𐬕 1 pXŌvZ
+	constexpr Vector3 Vector3::Lerp(const tnl::Vector3& s, const tnl::Vector3& e, float _stage_id) noexcept {
+		return {
+			s.x + (e.x - s.x) * _stage_id,
+			s.y + (e.y - s.y) * _stage_id,
+			s.z + (e.z - s.z) * _stage_id };
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline float Vector3::Dot(const tnl::Vector3& v1, const tnl::Vector3& v2) noexcept {
-		return DirectX::XMVector3Dot(DirectX::XMLoadFloat3(&v1), DirectX::XMLoadFloat3(&v2)).m128_f32[0];
+	constexpr float Vector3::Dot(const tnl::Vector3& v1, const tnl::Vector3& v2) noexcept {
+		if (std::is_constant_evaluated()) {
+			return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+		}
+		return simd::Dot3(simd::Load3(v1), simd::Load3(v2));
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3 Vector3::Cross(const tnl::Vector3& v1, const tnl::Vector3& v2) noexcept {
-		XMFLOAT3 f3;
-		DirectX::XMStoreFloat3(&f3, DirectX::XMVector3Cross(DirectX::XMLoadFloat3(&v1), DirectX::XMLoadFloat3(&v2)));
-		return static_cast<Vector3>(f3);
+	constexpr Vector3 Vector3::Cross(const tnl::Vector3& v1, const tnl::Vector3& v2) noexcept {
+		if (std::is_constant_evaluated()) {
+			return { v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x };
+		}
+		return Vector3(simd::Cross3(simd::Load3(v1), simd::Load3(v2)));
 	}
 	//-----------------------------------------------------------------------------------------------------
-	inline Vector3 Vector3::Rot2D(const tnl::Vector3 v, float sin, float cos) noexcept {
+	constexpr Vector3 Vector3::Rot2D(const tnl::Vector3 v, float sin, float cos) noexcept {
 		return Vector3(v.x * cos - v.y * sin, v.x * sin + v.y * cos, 0.0);
 	}
 	//-----------------------------------------------------------------------------------------------------
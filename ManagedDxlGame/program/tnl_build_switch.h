@@ -1,3 +1,4 @@
 #pragma once
 #define TNL_BULID_SWITCH_DX_LIB
+//#define TNL_BUILD_SWITCH_SIMD_SCALAR
 